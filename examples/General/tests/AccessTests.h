@@ -0,0 +1,215 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef ACCESS_TESTS_H
+#define ACCESS_TESTS_H
+
+#if defined(TARGET_STORAGE)
+  #define TARGET_LIBRARY EEPROMStorage<T>
+#else
+  #define TARGET_LIBRARY EEPROMCache<T>
+#endif
+
+#include <EEPROM-Debug.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+//
+// These tests use the access counters of the simulated
+// EEPROM and only run in the host build.
+//
+#if defined(EEPROM_HOST)
+
+template <typename T>
+class ReadAccessTest : public RunOnceTest<T>
+{
+  public:
+    ReadAccessTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 2; }
+
+    int onRunOnce()
+    {
+      //
+      // Set the initial value.
+      //
+      TARGET_LIBRARY item(this->_address);
+      item = (T)random(this->_minValue, this->_maxValue);
+
+      #if defined(TARGET_CACHE)
+      item.commit();
+      #endif
+
+      //
+      // Read the value back and count the EEPROM accesses.
+      //
+      EEPROM.resetCounters();
+
+      #if defined(TARGET_CACHE)
+      item.restore();
+      #else
+      T value = item.get();
+      (void)value;
+      #endif
+
+      uint touchedOnce = 0;
+
+      for (uint i = 0; i < item.length(); i++)
+      {
+        touchedOnce += (EEPROM.readCount(item.getAddress() + i) == 1) ? 1 : 0;
+      }
+
+      //
+      // Assert
+      //
+      DEBUG_INFO("\tEach Byte Read Once: ");
+      int returnValue = Assert.AreEqual(touchedOnce, item.length());
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tTotal Reads: ");
+      returnValue += Assert.AreEqual((uint)EEPROM.totalReads(), item.length());
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+template <typename T>
+class WriteAccessTest : public RunOnceTest<T>
+{
+  public:
+    WriteAccessTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 2; }
+
+    int onRunOnce()
+    {
+      //
+      // Set the initial value.
+      //
+      TARGET_LIBRARY item(this->_address);
+      item = this->_minValue;
+
+      #if defined(TARGET_CACHE)
+      item.commit();
+      #endif
+
+      //
+      // Write a new value and count the EEPROM accesses.
+      //
+      EEPROM.resetCounters();
+
+      #if defined(TARGET_CACHE)
+      item.set(this->_maxValue);
+      T value = item.commit();
+      #else
+      T value = item.set(this->_maxValue);
+      #endif
+
+      //
+      // Assert
+      //
+      DEBUG_INFO("\tValue Returned: ");
+      int returnValue = Assert.AreEqual(value, this->_maxValue);
+
+      //
+      // A commit only reads the bytes that changed.
+      //
+      DEBUG_INFO("");
+      DEBUG_INFO("\tTotal Reads: ");
+      #if defined(TARGET_CACHE)
+      returnValue += Assert.IsTrue(EEPROM.totalReads() <= item.length());
+      #else
+      returnValue += Assert.AreEqual((uint)EEPROM.totalReads(), item.length());
+      #endif
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+#if defined(TARGET_CACHE)
+template <typename T>
+class CommitAccessTest : public RunOnceTest<T>
+{
+  public:
+    CommitAccessTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 4; }
+
+    int onRunOnce()
+    {
+      //
+      // Set the initial value.
+      //
+      TARGET_LIBRARY item(this->_address);
+      item = this->_minValue;
+      item.commit();
+
+      //
+      // Commit without changes.
+      //
+      EEPROM.resetCounters();
+      item.commit();
+
+      //
+      // Assert
+      //
+      DEBUG_INFO("\tUnchanged Commit Accesses: ");
+      int returnValue = Assert.AreEqual((uint)(EEPROM.totalReads() + EEPROM.totalWrites()), (uint)0);
+
+      //
+      // Change only the first byte and commit.
+      //
+      T value = item.get();
+      ((byte*)&value)[0] ^= 0x01;
+      item = value;
+
+      EEPROM.resetCounters();
+      item.commit();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tPartial Commit Reads: ");
+      returnValue += Assert.AreEqual((uint)EEPROM.totalReads(), (uint)2);
+
+      item.restore();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tPartial Commit Value: ");
+      returnValue += Assert.AreEqual(item.get(), value);
+
+      //
+      // A commit after unset() writes the whole value.
+      //
+      item.unset();
+      ((byte*)&value)[0] ^= 0x01;
+      item = value;
+      item.commit();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCommit After Unset: ");
+      returnValue += Assert.IsTrue(item.isInitialized() && item.restore() == value);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+#endif
+#endif
+#endif
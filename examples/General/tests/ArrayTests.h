@@ -0,0 +1,147 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef ARRAY_TESTS_H
+#define ARRAY_TESTS_H
+
+#include <EEPROM-Debug.h>
+#include <EEPROM-Array.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+//
+// Tests an array with one checksum per element and an array
+// with one checksum per block of four elements, the last of
+// which is partly filled.
+//
+template <typename T>
+class ArrayTest : public RunOnceTest<T>
+{
+  public:
+    ArrayTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    #if defined(EEPROM_HOST)
+    int totalTests() { return 14; }
+    #else
+    int totalTests() { return 12; }
+    #endif
+
+    int onRunOnce()
+    {
+      EEPROMArray<T, 10> elements(this->_address, this->_minValue);
+      int returnValue = this->check(elements, "Element");
+
+      EEPROMArray<T, 10, 4> blocks(this->_address, this->_minValue);
+      DEBUG_INFO("");
+      returnValue += this->check(blocks, "Block");
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+
+  protected:
+    template <typename TArray>
+    int check(TArray& array, const char* name)
+    {
+      array.unset();
+
+      DEBUG_INFO("\t%s Default: ", name);
+      int returnValue = Assert.IsTrue(!array.isInitialized(3) && array[3] == this->_minValue);
+
+      T value = (T)random(this->_minValue, this->_maxValue - 10);
+      array[7] = value;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\t%s Set: ", name);
+      returnValue += Assert.IsTrue(array.isInitialized(7) && array[7] == value && array[6] == this->_minValue);
+
+      array[2] = value;
+      T old = array[2]++;
+      array[2] += 1;
+      array[1] = array[2];
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\t%s Operators: ", name);
+      returnValue += Assert.IsTrue(old == value && array[2] == (T)(value + 2) && array[1] == (T)(value + 2));
+
+      array.fill(value);
+      bool same = true;
+      uint count = 0;
+
+      for (T item : array)
+      {
+        same = same && (item == value);
+        count++;
+      }
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\t%s Fill and Iterate: ", name);
+      returnValue += Assert.IsTrue(same && count == array.size());
+
+      T values[5];
+      T copied[5];
+
+      for (uint i = 0; i < 5; i++)
+      {
+        values[i] = (T)random(this->_minValue, this->_maxValue);
+      }
+
+      array.copyFrom(values, 3, 5);
+      array.copyTo(copied, 3, 5);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\t%s Copy: ", name);
+      returnValue += Assert.IsTrue(memcmp(values, copied, sizeof(values)) == 0 && array[2] == value && array[8] == value);
+
+      //
+      // Damaging the first block leaves the others intact. Bit 0
+      // is not used because a checksum of all ones is stored
+      // shifted left, which would hide the flip.
+      //
+      EEPROM.write(array.getAddress(), EEPROM.read(array.getAddress()) ^ 0x10);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\t%s Isolation: ", name);
+      returnValue += Assert.IsTrue(!array.isInitialized(0) && array[0] == this->_minValue && array[9] == value);
+
+      #if defined(EEPROM_HOST)
+      //
+      // An element reads its block and iterating reads each byte once.
+      //
+      EEPROM.resetCounters();
+      array.get(9);
+      uint elementReads = EEPROM.totalReads();
+
+      EEPROM.resetCounters();
+
+      for (T item : array)
+      {
+        (void)item;
+      }
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\t%s Block Reads: ", name);
+      returnValue += Assert.IsTrue(elementReads == ((array.size() - 1) % TArray::BLOCK + 1) * sizeof(T) + sizeof(typename TArray::checksum_t) &&
+                                   EEPROM.totalReads() == array.length());
+      #endif
+
+      return returnValue;
+    }
+};
+#endif
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "Assert.h"
 
+AssertClass Assert;
+
 //
 // Boolean
 //
@@ -76,5 +76,5 @@ class AssertClass
     bool DebugEqualNotEqual(bool, double, double);
 };
 
-static AssertClass Assert;
+extern AssertClass Assert;
 #endif
\ No newline at end of file
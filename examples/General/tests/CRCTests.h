@@ -0,0 +1,388 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef CRC_TESTS_H
+#define CRC_TESTS_H
+
+#include <EEPROM-Debug.h>
+#include <EEPROM-Storage.h>
+#include <EEPROM-Cache.h>
+#include <EEPROM-CRC.h>
+#include <EEPROM-Registry.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+//
+// Checks each engine and implementation against the
+// standard check value of the string "123456789".
+//
+template <typename T>
+class CRCCheckValueTest : public RunOnceTest<T>
+{
+  public:
+    CRCCheckValueTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 9; }
+
+    int onRunOnce()
+    {
+      byte data[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+      int returnValue = 0;
+
+      DEBUG_INFO("\tCRC-8 Check Value: ");
+      returnValue += Assert.AreEqual((unsigned long)CRC8<T, EEPROM_CRC_TABLE>::get(data, sizeof(data)), 0xFBUL);
+      returnValue += Assert.AreEqual((unsigned long)CRC8<T, EEPROM_CRC_NIBBLE>::get(data, sizeof(data)), 0xFBUL);
+      returnValue += Assert.AreEqual((unsigned long)CRC8<T, EEPROM_CRC_BITWISE>::get(data, sizeof(data)), 0xFBUL);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCRC-16 Check Value: ");
+      returnValue += Assert.AreEqual((unsigned long)CRC16<T, EEPROM_CRC_TABLE>::get(data, sizeof(data)), 0x29B1UL);
+      returnValue += Assert.AreEqual((unsigned long)CRC16<T, EEPROM_CRC_NIBBLE>::get(data, sizeof(data)), 0x29B1UL);
+      returnValue += Assert.AreEqual((unsigned long)CRC16<T, EEPROM_CRC_BITWISE>::get(data, sizeof(data)), 0x29B1UL);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCRC-32 Check Value: ");
+      returnValue += Assert.AreEqual((unsigned long)CRC32<T, EEPROM_CRC_TABLE>::get(data, sizeof(data)), 0xCBF43926UL);
+      returnValue += Assert.AreEqual((unsigned long)CRC32<T, EEPROM_CRC_NIBBLE>::get(data, sizeof(data)), 0xCBF43926UL);
+      returnValue += Assert.AreEqual((unsigned long)CRC32<T, EEPROM_CRC_BITWISE>::get(data, sizeof(data)), 0xCBF43926UL);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+//
+// The word at a time XOR kernel has to match the byte
+// at a time kernel for every length and alignment.
+//
+template <typename T>
+class ChecksumKernelTest : public RunOnceTest<T>
+{
+  public:
+    ChecksumKernelTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 1; }
+
+    int onRunOnce()
+    {
+      byte data[72];
+      bool identical = true;
+
+      for (uint i = 0; i < sizeof(data); i++)
+      {
+        data[i] = (byte)random(256);
+      }
+
+      for (uint offset = 0; offset < 8; offset++)
+      {
+        for (uint length = 0; length <= sizeof(data) - offset; length++)
+        {
+          if (Checksum<T>::foldWords(data + offset, length) != Checksum<T>::foldBytes(data + offset, length))
+          {
+            identical = false;
+          }
+        }
+      }
+
+      DEBUG_INFO("\tWide Kernel Matches Byte Kernel: ");
+      int returnValue = Assert.IsTrue(identical);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+template <typename T>
+class CRCValueTest : public RunOnceTest<T>
+{
+  public:
+    CRCValueTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 4; }
+
+    int onRunOnce()
+    {
+      T value = (T)random(this->_minValue, this->_maxValue);
+
+      EEPROMStorage<T, CRC16<T>> item16(this->_address, this->_minValue);
+      item16.unset();
+      item16 = value;
+
+      DEBUG_INFO("\tCRC-16 Length: ");
+      int returnValue = Assert.AreEqual(item16.length(), (uint)(sizeof(T) + 2));
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCRC-16 Value: ");
+      returnValue += Assert.AreEqual(item16.get(), value);
+
+      EEPROMStorage<T, CRC32<T>> item32(this->_address, this->_minValue);
+      item32.unset();
+      item32 = value;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCRC-32 Length: ");
+      returnValue += Assert.AreEqual(item32.length(), (uint)(sizeof(T) + 4));
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCRC-32 Value: ");
+      returnValue += Assert.AreEqual(item32.get(), value);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+//
+// Two swapped bytes leave the XOR checksum unchanged
+// but have to be detected by the CRC.
+//
+template <typename T>
+class CRCSwapTest : public RunOnceTest<T>
+{
+  public:
+    CRCSwapTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 2; }
+
+    int onRunOnce()
+    {
+      T value;
+      byte* data = (byte*)&value;
+
+      for (uint i = 0; i < sizeof(T); i++)
+      {
+        data[i] = i + 1;
+      }
+
+      EEPROMStorage<T> xorItem(this->_address, this->_minValue);
+      xorItem = value;
+      this->swap(xorItem.getAddress());
+
+      DEBUG_INFO("\tXOR Misses Swap: ");
+      int returnValue = Assert.IsTrue(xorItem.isInitialized());
+
+      EEPROMStorage<T, CRC16<T>> crcItem(this->_address, this->_minValue);
+      crcItem = value;
+      this->swap(crcItem.getAddress());
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCRC-16 Detects Swap: ");
+      returnValue += Assert.IsFalse(crcItem.isInitialized());
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+
+  protected:
+    void swap(uint address)
+    {
+      byte b = EEPROM.read(address);
+      EEPROM.write(address, EEPROM.read(address + 1));
+      EEPROM.write(address + 1, b);
+    }
+};
+//
+// A block of bytes for the incremental checksum tests.
+//
+struct ChecksumBlock
+{
+  byte data[40];
+};
+
+//
+// Updating a CRC from the changed bytes has to give the
+// same result as computing it over the whole value.
+//
+template <typename T>
+class CRCReplaceTest : public RunOnceTest<T>
+{
+  public:
+    CRCReplaceTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 3; }
+
+    int onRunOnce()
+    {
+      DEBUG_INFO("\tCRC-8 Replace: ");
+      int returnValue = Assert.IsTrue(this->matches<CRC8<ChecksumBlock>>());
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCRC-16 Replace: ");
+      returnValue += Assert.IsTrue(this->matches<CRC16<ChecksumBlock>>());
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCRC-32 Replace: ");
+      returnValue += Assert.IsTrue(this->matches<CRC32<ChecksumBlock>>());
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+
+  protected:
+    template <typename TChecksum>
+    bool matches()
+    {
+      bool returnValue = true;
+      ChecksumBlock block;
+
+      for (uint i = 0; i < sizeof(block.data); i++)
+      {
+        block.data[i] = (byte)random(256);
+      }
+
+      for (uint n = 0; n < 50; n++)
+      {
+        uint offset = random(sizeof(block.data));
+        uint length = random(1, sizeof(block.data) - offset + 1);
+        ChecksumBlock next = block;
+
+        for (uint i = offset; i < offset + length; i++)
+        {
+          next.data[i] = (byte)random(256);
+        }
+
+        typename TChecksum::checksum_t checksum = TChecksum::get(block);
+
+        if (TChecksum::replace(checksum, offset, block.data + offset, next.data + offset, length) && checksum != TChecksum::get(next))
+        {
+          returnValue = false;
+        }
+
+        block = next;
+      }
+
+      return returnValue;
+    }
+};
+
+//
+// Writes that change a few bytes keep a valid checksum. A commit
+// updates the checksum it wrote from the changed bytes.
+//
+template <typename T>
+class IncrementalWriteTest : public RunOnceTest<T>
+{
+  public:
+    IncrementalWriteTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    #if defined(EEPROM_HOST)
+    int totalTests() { return 5; }
+    #else
+    int totalTests() { return 4; }
+    #endif
+
+    int onRunOnce()
+    {
+      ChecksumBlock block;
+      memset(&block, 0, sizeof(block));
+
+      EEPROMStorage<ChecksumBlock> xorItem(this->_address, block);
+      EEPROMRegistry.clear();
+      EEPROMRegistry.add(xorItem);
+      int returnValue = this->check(xorItem, "\tXOR Partial Writes: ");
+
+      EEPROMStorage<ChecksumBlock, CRC16<ChecksumBlock>> crcItem(this->_address, block);
+      EEPROMRegistry.clear();
+      EEPROMRegistry.add(crcItem);
+      DEBUG_INFO("");
+      returnValue += this->check(crcItem, "\tCRC-16 Partial Writes: ");
+
+      //
+      // A commit after restore() updates the checksum from
+      // the dirty blocks.
+      //
+      EEPROMRegistry.clear();
+      EEPROMCache<ChecksumBlock, CRC16<ChecksumBlock>> cache(this->_address, block);
+      cache.restore();
+      ChecksumBlock value = cache.get();
+      value.data[sizeof(value.data) - 1]++;
+      cache = value;
+      cache.commit();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tIncremental Commit: ");
+      returnValue += Assert.IsTrue(cache.checksum() == cache.checksumByte() && cache.restore().data[sizeof(value.data) - 1] == value.data[sizeof(value.data) - 1]);
+
+      //
+      // Another instance unsets the variable after the registry
+      // cached it as valid, the next write has to compute the
+      // whole checksum.
+      //
+      EEPROMRegistry.add(crcItem);
+      EEPROMRegistry.scan();
+      EEPROMStorage<ChecksumBlock, CRC16<ChecksumBlock>> other(this->_address, block);
+      other.unset();
+      value.data[1]++;
+      crcItem = value;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tWrite After Unset: ");
+      ChecksumBlock stored = crcItem.get();
+      returnValue += Assert.IsTrue(crcItem.checksum() == crcItem.checksumByte() && memcmp(&stored, &value, sizeof(value)) == 0);
+
+      #if defined(EEPROM_HOST)
+      //
+      // One changed byte writes one value byte and the checksum.
+      //
+      value.data[0]++;
+      EEPROMRegistry.add(crcItem);
+      EEPROMRegistry.scan();
+      EEPROM.resetCounters();
+      crcItem = value;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tChanged Bytes Only: ");
+      returnValue += Assert.IsTrue(EEPROM.totalReads() == crcItem.length() && EEPROM.totalWrites() <= 3);
+      #endif
+
+      EEPROMRegistry.clear();
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+
+  protected:
+    template <typename TVariable>
+    int check(TVariable& item, const char* name)
+    {
+      ChecksumBlock value;
+
+      for (uint i = 0; i < sizeof(value.data); i++)
+      {
+        value.data[i] = (byte)random(256);
+      }
+
+      item = value;
+      EEPROMRegistry.scan();
+
+      for (uint n = 0; n < 20; n++)
+      {
+        value.data[random(sizeof(value.data))] = (byte)random(256);
+        item = value;
+      }
+
+      //
+      // Compare with a checksum computed over the EEPROM,
+      // not with the cached isInitialized().
+      //
+      ChecksumBlock stored = item.get();
+      DEBUG_INFO(name);
+      return Assert.IsTrue(item.checksum() == item.checksumByte() && memcmp(&stored, &value, sizeof(value)) == 0);
+    }
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,76 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef CLEAR_TESTS_H
+#define CLEAR_TESTS_H
+
+#include <EEPROM-Debug.h>
+#include <EEPROM-Storage.h>
+#include <EEPROM-Util.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+//
+// Clears the middle one of three variables.
+//
+template <typename T>
+class ClearRangeTest : public RunOnceTest<T>
+{
+  public:
+    ClearRangeTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    #if defined(EEPROM_HOST)
+    int totalTests() { return 3; }
+    #else
+    int totalTests() { return 2; }
+    #endif
+
+    int onRunOnce()
+    {
+      EEPROMStorage<T> a(this->_address, this->_minValue);
+      EEPROMStorage<T> b(a.nextAddress(), this->_minValue);
+      EEPROMStorage<T> c(b.nextAddress(), this->_minValue);
+
+      a = (T)random(this->_minValue, this->_maxValue);
+      b = (T)random(this->_minValue, this->_maxValue);
+      c = (T)random(this->_minValue, this->_maxValue);
+
+      EEPROMUtil.clearEEPROM(UNSET_VALUE, b.getAddress(), b.nextAddress());
+
+      DEBUG_INFO("\tRange Cleared: ");
+      int returnValue = Assert.IsFalse(b.isInitialized());
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tOutside Range Kept: ");
+      returnValue += Assert.IsTrue(a.isInitialized() && c.isInitialized());
+
+      #if defined(EEPROM_HOST)
+      EEPROM.resetCounters();
+      EEPROMUtil.clearEEPROM(UNSET_VALUE, b.getAddress(), b.nextAddress());
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCleared Range Not Written: ");
+      returnValue += Assert.AreEqual(EEPROM.totalWrites(), (uint32_t)0);
+      #endif
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+#endif
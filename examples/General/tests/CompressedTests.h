@@ -0,0 +1,121 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef COMPRESSED_TESTS_H
+#define COMPRESSED_TESTS_H
+
+#include <EEPROM-Debug.h>
+#include <EEPROM-Compressed.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+#define COMPRESSED_TABLE_SIZE 16 ///< The number of entries in the test table.
+
+//
+// A table that is mostly zero.
+//
+template <typename T>
+struct CompressedTable
+{
+  T values[COMPRESSED_TABLE_SIZE];
+};
+
+template <typename T>
+class CompressedTest : public RunOnceTest<T>
+{
+  public:
+    CompressedTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    #if defined(EEPROM_HOST)
+    int totalTests() { return 6; }
+    #else
+    int totalTests() { return 5; }
+    #endif
+
+    int onRunOnce()
+    {
+      EEPROMCompressed<CompressedTable<T>> item(this->_address);
+      item.unset();
+
+      DEBUG_INFO("\tNot Initialized: ");
+      int returnValue = Assert.IsFalse(item.isInitialized());
+
+      CompressedTable<T> table;
+      memset(&table, 0, sizeof(table));
+      table.values[1] = (T)random(this->_minValue, this->_maxValue);
+      table.values[9] = this->_maxValue;
+      item = table;
+
+      //
+      // A new instance has to decode the stored image.
+      //
+      EEPROMCompressed<CompressedTable<T>> restored(this->_address);
+      CompressedTable<T> value = restored.get();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tValue Restored: ");
+      returnValue += Assert.IsTrue(memcmp(&value, &table, sizeof(table)) == 0);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCompressed %u of %u bytes: ", restored.compressedLength(), (uint)sizeof(table));
+      returnValue += Assert.IsTrue(restored.compressedLength() == restored.encodedLength(table) && restored.ratio() > 1.0);
+
+      //
+      // A value whose encoding does not fit is not written.
+      //
+      EEPROMCompressed<CompressedTable<T>, sizeof(CompressedTable<T>) / 2> half(this->_address);
+      CompressedTable<T> dense;
+      memset(&dense, 0x5A, sizeof(dense));
+      half = table;
+      bool written = half.write(dense);
+      value = half.get();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCapacity Exceeded: ");
+      returnValue += Assert.IsTrue(!written && memcmp(&value, &table, sizeof(table)) == 0);
+
+      //
+      // A length larger than the capacity is rejected.
+      //
+      EEPROM.write(half.getAddress(), (sizeof(CompressedTable<T>) / 2) + 1);
+      EEPROM.write(half.getAddress() + 1, 0);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tInvalid Length: ");
+      returnValue += Assert.IsFalse(half.isInitialized());
+
+      #if defined(EEPROM_HOST)
+      //
+      // A read touches only the header and the encoded bytes.
+      //
+      item = table;
+      EEPROM.resetCounters();
+      value = item.get();
+      uint32_t reads = EEPROM.totalReads();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tReads %u: ", reads);
+      returnValue += Assert.IsTrue(reads == item.HEADER_LENGTH + item.compressedLength());
+      #endif
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+#endif
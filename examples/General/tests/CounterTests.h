@@ -0,0 +1,173 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef COUNTER_TESTS_H
+#define COUNTER_TESTS_H
+
+#include <EEPROM-Debug.h>
+#include <EEPROM-Storage.h>
+#include <EEPROM-Counter.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+template <typename T>
+class CounterTest : public RunOnceTest<T>
+{
+  public:
+    CounterTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 5; }
+
+    int onRunOnce()
+    {
+      EEPROMCounter<T> counter(this->_address);
+      counter.unset();
+
+      DEBUG_INFO("\tNot Initialized: ");
+      int returnValue = Assert.IsTrue(!counter.isInitialized() && counter.get() == 0);
+
+      //
+      // Count past several steps of the high word.
+      //
+      T expected = (3 * EEPROMCounter<T>::PERIOD) + 5;
+
+      for (T i = 0; i < expected; i++)
+      {
+        counter++;
+      }
+
+      EEPROMCounter<T> restored(this->_address);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tIncrement: ");
+      returnValue += Assert.IsTrue(counter.get() == expected && restored.get() == expected);
+
+      restored += 100;
+      restored -= 7;
+      expected += 93;
+      EEPROMCounter<T> adjusted(this->_address);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCompound Assignment: ");
+      returnValue += Assert.IsTrue(restored.get() == expected && adjusted.get() == expected);
+
+      T value = (T)random(this->_minValue, this->_maxValue);
+      adjusted = value;
+      EEPROMCounter<T> assigned(this->_address);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tAssignment: ");
+      returnValue += Assert.IsTrue(adjusted.get() == value && (T)assigned == value);
+
+      //
+      // Assigning another counter writes its count, pool bits included.
+      //
+      EEPROMCounter<T> other(this->_address - counter.length());
+      other.unset();
+      other = expected;
+      assigned = other;
+      EEPROMCounter<T> copied(this->_address);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCounter Assignment: ");
+      returnValue += Assert.IsTrue(assigned.get() == expected && copied.get() == expected && other.get() == expected);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+//
+// Uses the access counters and the power failure
+// simulation of the simulated EEPROM.
+//
+#if defined(EEPROM_HOST)
+template <typename T>
+class CounterWearTest : public RunOnceTest<T>
+{
+  public:
+    CounterWearTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 2; }
+
+    int onRunOnce()
+    {
+      const uint increments = 1000;
+
+      EEPROMStorage<T> storage(this->_address, 0);
+      storage = 0;
+      EEPROM.resetCounters();
+
+      for (uint i = 0; i < increments; i++)
+      {
+        storage++;
+      }
+
+      uint32_t storageWear = EEPROM.maxWriteCount();
+
+      EEPROMCounter<T> counter(this->_address);
+      counter.unset();
+      counter = 0;
+      EEPROM.resetCounters();
+
+      for (uint i = 0; i < increments; i++)
+      {
+        counter++;
+      }
+
+      uint32_t counterWear = EEPROM.maxWriteCount();
+
+      DEBUG_INFO("\tHighest cell write count %u (EEPROMStorage) vs %u (EEPROMCounter): ", storageWear, counterWear);
+      int returnValue = Assert.IsTrue((counterWear * 10) <= storageWear);
+
+      //
+      // Drop the writes of a carry into the high word after
+      // every possible number of bytes.
+      //
+      T before = EEPROMCounter<T>::PERIOD - 1;
+      uint survived = 0;
+      uint attempts = EEPROMCounter<T>::LENGTH;
+
+      for (uint i = 0; i <= attempts; i++)
+      {
+        counter = before;
+
+        EEPROM.failAfter(i);
+        counter++;
+        EEPROM.failAfter(EEPROMHostClass::NO_FAILURE);
+
+        EEPROMCounter<T> restored(this->_address);
+        T value = restored.get();
+
+        if (value == before || value == before + 1)
+        {
+          survived++;
+        }
+      }
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCount Survived %u of %u Torn Carries: ", survived, attempts + 1);
+      returnValue += Assert.AreEqual(survived, attempts + 1);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+#endif
+#endif
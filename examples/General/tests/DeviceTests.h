@@ -0,0 +1,185 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef DEVICE_TESTS_H
+#define DEVICE_TESTS_H
+
+//
+// These tests use the simulated 24LC256 and
+// only run on the host.
+//
+#if defined(EEPROM_HOST)
+#include <EEPROM-Debug.h>
+#include <EEPROM-Storage.h>
+#include <EEPROM-Cache.h>
+#include <EEPROM-WearLeveled.h>
+#include <EEPROM-Device.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+#define DEVICE_PAGE_SIZE 64
+
+typedef EEPROMHost24LC<32768, DEVICE_PAGE_SIZE> TestDevice;
+
+//
+// Two full pages of data.
+//
+struct DeviceBlock
+{
+  byte data[DEVICE_PAGE_SIZE * 2];
+};
+
+template <typename T>
+class DeviceValueTest : public RunOnceTest<T>
+{
+  public:
+    DeviceValueTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 3; }
+
+    int onRunOnce()
+    {
+      static TestDevice device;
+      EEPROMUtil.setDevice(&device);
+      uint32_t internalWrites = EEPROM.totalWrites();
+
+      T value = (T)random(this->_minValue, this->_maxValue);
+
+      EEPROMStorage<T> storage(this->_address, this->_minValue);
+      storage = value;
+
+      DEBUG_INFO("\tStorage Value: ");
+      int returnValue = Assert.AreEqual(EEPROMStorage<T>(this->_address, this->_minValue).get(), value);
+
+      EEPROMWearLeveled<T, 4> leveled(storage.nextAddress(), this->_minValue);
+      leveled.unset();
+
+      for (uint i = 0; i < 6; i++)
+      {
+        leveled = value;
+      }
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tWear Leveled Value: ");
+      returnValue += Assert.AreEqual(EEPROMWearLeveled<T, 4>(storage.nextAddress(), this->_minValue).get(), value);
+
+      EEPROMUtil.setDevice(nullptr);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tInternal EEPROM Not Written: ");
+      returnValue += Assert.AreEqual(EEPROM.totalWrites(), internalWrites);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+template <typename T>
+class DevicePageWriteTest : public RunOnceTest<T>
+{
+  public:
+    DevicePageWriteTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 7; }
+
+    int onRunOnce()
+    {
+      static TestDevice device;
+      EEPROMUtil.setDevice(&device);
+
+      DeviceBlock block;
+
+      for (uint i = 0; i < sizeof(block.data); i++)
+      {
+        block.data[i] = (byte)random(0, 255);
+      }
+
+      //
+      // A page aligned block and its checksum span three pages.
+      //
+      EEPROMStorage<DeviceBlock> storage(DEVICE_PAGE_SIZE * 4);
+      device.resetCounters();
+      storage = block;
+
+      DEBUG_INFO("\tPage Writes (%u, %u us): ", device.pageWrites(), device.elapsed());
+      int returnValue = Assert.AreEqual(device.pageWrites(), (uint32_t)3);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tValue: ");
+      returnValue += Assert.IsTrue(storage.isInitialized() && memcmp(storage.get().data, block.data, sizeof(block.data)) == 0);
+
+      device.resetCounters();
+      storage = block;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tUnchanged Write: ");
+      returnValue += Assert.AreEqual(device.pageWrites(), (uint32_t)0);
+
+      //
+      // A single changed byte writes its page and the checksum page.
+      // Bit 0 is not used because a checksum of all ones is stored
+      // shifted left, which could leave the checksum unchanged.
+      //
+      EEPROMCache<DeviceBlock> cache(DEVICE_PAGE_SIZE * 4);
+      block.data[3] ^= 0x02;
+      cache = block;
+      device.resetCounters();
+      cache.commit();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCommit One Byte: ");
+      returnValue += Assert.AreEqual(device.pageWrites(), (uint32_t)2);
+
+      device.resetCounters();
+      storage.unset();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tUnset: ");
+      returnValue += Assert.IsTrue(device.pageWrites() == 3 && !storage.isInitialized());
+
+      //
+      // Clearing the device only writes the pages that were used.
+      //
+      EEPROMStorage<DeviceBlock>(0) = block;
+      device.resetCounters();
+      EEPROMUtil.clearEEPROM();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tClear: ");
+      returnValue += Assert.AreEqual(device.pageWrites(), (uint32_t)3);
+
+      //
+      // A fill that is lost is reported when it is verified.
+      //
+      device.failAfter(0);
+      bool filled = EEPROMUtil.fillBlock(0, 0x5A, DEVICE_PAGE_SIZE, true);
+      device.failAfter(TestDevice::NO_FAILURE);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tLost Fill Verified: ");
+      returnValue += Assert.IsFalse(filled);
+
+      EEPROMUtil.setDevice(nullptr);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+#endif
+#endif
@@ -0,0 +1,159 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef FIELD_TESTS_H
+#define FIELD_TESTS_H
+
+#include <EEPROM-Debug.h>
+#include <EEPROM-Storage.h>
+#include <EEPROM-Registry.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+//
+// A structure with a field of the type under test.
+//
+template <typename T>
+struct FieldRecord
+{
+  uint32_t id;
+  T value;
+  byte tag;
+  byte data[40];
+};
+
+template <typename T>
+class FieldTest : public RunOnceTest<T>
+{
+  public:
+    FieldTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    #if defined(EEPROM_HOST)
+    int totalTests() { return 7; }
+    #else
+    int totalTests() { return 5; }
+    #endif
+
+    int onRunOnce()
+    {
+      FieldRecord<T> defaults;
+      memset(&defaults, 0, sizeof(defaults));
+      defaults.value = this->_minValue;
+
+      EEPROMStorage<FieldRecord<T>> storage(this->_address, defaults);
+
+      FieldRecord<T> record;
+      memset(&record, 0, sizeof(record));
+      record.id = (uint32_t)random(1, 100000);
+      record.value = (T)random(this->_minValue, this->_maxValue);
+      record.data[0] = (byte)random(255);
+      storage = record;
+
+      DEBUG_INFO("\tGet Field: ");
+      int returnValue = Assert.IsTrue(storage.getField(&FieldRecord<T>::value) == record.value &&
+                                      storage.getField(&FieldRecord<T>::id) == record.id);
+
+      T value = (T)random(this->_minValue, this->_maxValue);
+      storage.setField(&FieldRecord<T>::value, value);
+      record.value = value;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tSet Field: ");
+      FieldRecord<T> stored = storage.get();
+      returnValue += Assert.IsTrue(storage.isInitialized() && memcmp(&record, &stored, sizeof(record)) == 0);
+
+      #if defined(EEPROM_HOST)
+      //
+      // Without the registry the structure is read once.
+      //
+      EEPROM.resetCounters();
+      storage.getField(&FieldRecord<T>::value);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tSingle Read Without Registry: ");
+      returnValue += Assert.AreEqual((uint)EEPROM.totalReads(), storage.length());
+
+      //
+      // With a cached isInitialized() only the field
+      // and the checksum are accessed.
+      //
+      EEPROMRegistry.clear();
+      EEPROMRegistry.add(storage);
+      EEPROMRegistry.scan();
+
+      //
+      // An ambiguous checksum is recomputed from the whole
+      // structure, so change the tag to avoid it.
+      //
+      if (storage.checksumByte() == (byte)(UNSET_VALUE << 1))
+      {
+        record.tag ^= 0x10;
+        storage.setField(&FieldRecord<T>::tag, record.tag);
+      }
+
+      EEPROM.resetCounters();
+      storage.setField(&FieldRecord<T>::id, record.id + 1);
+      record.id++;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tField Access Only: ");
+      returnValue += Assert.IsTrue(EEPROM.totalReads() <= 2 * (sizeof(uint32_t) + 1) && EEPROM.totalWrites() <= sizeof(uint32_t) + 1);
+      EEPROMRegistry.clear();
+      #endif
+
+      //
+      // Find a tag whose checksum is the shifted UNSET_VALUE,
+      // which has to be recomputed on the next change.
+      //
+      for (uint tag = 0; tag < 256 && storage.checksumByte() != (byte)(UNSET_VALUE << 1); tag++)
+      {
+        storage.setField(&FieldRecord<T>::tag, (byte)tag);
+        record.tag = (byte)tag;
+      }
+
+      storage.setField(&FieldRecord<T>::id, record.id + 1);
+      record.id++;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tAmbiguous Checksum: ");
+      stored = storage.get();
+      returnValue += Assert.IsTrue(storage.isInitialized() && memcmp(&record, &stored, sizeof(record)) == 0);
+
+      EEPROMStorage<FieldRecord<T>, CRC16<FieldRecord<T>>> crc(this->_address, defaults);
+      crc = record;
+      crc.setField(&FieldRecord<T>::value, (T)(record.value + 1));
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCRC Field: ");
+      returnValue += Assert.IsTrue(crc.isInitialized() && crc.get().value == (T)(record.value + 1));
+
+      storage.unset();
+      storage.setField(&FieldRecord<T>::value, value);
+      defaults.value = value;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tUninitialized Field: ");
+      stored = storage.get();
+      returnValue += Assert.IsTrue(storage.isInitialized() && memcmp(&defaults, &stored, sizeof(defaults)) == 0);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+#endif
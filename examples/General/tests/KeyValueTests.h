@@ -0,0 +1,142 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef KEY_VALUE_TESTS_H
+#define KEY_VALUE_TESTS_H
+
+#include <EEPROM-Debug.h>
+#include <EEPROM-KeyValue.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+#define KEY_VALUE_SLOTS 16 ///< The number of entries in the test table.
+
+template <typename T>
+class KeyValueTest : public RunOnceTest<T>
+{
+  public:
+    KeyValueTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    #if defined(EEPROM_HOST)
+    int totalTests() { return 7; }
+    #else
+    int totalTests() { return 6; }
+    #endif
+
+    int onRunOnce()
+    {
+      EEPROMKeyValue<KEY_VALUE_SLOTS, sizeof(T)> table(this->_address);
+      table.clear();
+
+      #if defined(EEPROM_HOST)
+      //
+      // A key whose filter bit is clear is not looked up.
+      //
+      EEPROM.resetCounters();
+      bool found = table.contains(1234);
+
+      DEBUG_INFO("\tMiss Reads: ");
+      int returnValue = Assert.IsTrue(!found && EEPROM.totalReads() == 0);
+      DEBUG_INFO("");
+      #else
+      int returnValue = 0;
+      #endif
+
+      for (uint i = 0; i < 10; i++)
+      {
+        table.put(this->key(i), this->value(i));
+      }
+
+      DEBUG_INFO("\tPut: ");
+      returnValue += Assert.IsTrue(table.count() == 10 && this->matches(table, 0, 10));
+
+      //
+      // A new instance rebuilds the bitmaps from the entries.
+      //
+      EEPROMKeyValue<KEY_VALUE_SLOTS, sizeof(T)> restored(this->_address);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tRebuild: ");
+      returnValue += Assert.IsTrue(restored.count() == 10 && this->matches(restored, 0, 10) && !restored.contains(this->key(10)));
+
+      restored.put(this->key(3), this->value(20));
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tUpdate: ");
+      returnValue += Assert.IsTrue(restored.count() == 10 && restored.template get<T>(this->key(3)) == this->value(20));
+
+      for (uint i = 0; i < 6; i++)
+      {
+        restored.remove(this->key(i));
+      }
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tRemove: ");
+      returnValue += Assert.IsTrue(restored.count() == 4 && restored.tombstones() == 6 && !restored.contains(this->key(0)) &&
+                                   !restored.contains(this->key(5)) && this->matches(restored, 6, 10));
+
+      //
+      // The next put compacts the tombstones.
+      //
+      restored.put(this->key(10), this->value(10));
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCompact: ");
+      returnValue += Assert.IsTrue(restored.count() == 5 && restored.tombstones() == 0 && this->matches(restored, 6, 11));
+
+      uint stored = 0;
+
+      for (uint i = 11; i < 11 + KEY_VALUE_SLOTS; i++)
+      {
+        stored += restored.put(this->key(i), this->value(i)) ? 1 : 0;
+      }
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tFull: ");
+      returnValue += Assert.IsTrue(stored == KEY_VALUE_SLOTS - 5 && restored.count() == KEY_VALUE_SLOTS && this->matches(restored, 6, 11 + stored));
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+
+  protected:
+    uint16_t key(uint i)
+    {
+      return (uint16_t)(100 + (i * 37));
+    }
+
+    T value(uint i)
+    {
+      return (T)(this->_minValue + i);
+    }
+
+    bool matches(EEPROMKeyValue<KEY_VALUE_SLOTS, sizeof(T)>& table, uint first, uint last)
+    {
+      bool returnValue = true;
+
+      for (uint i = first; i < last; i++)
+      {
+        T value;
+        returnValue = table.read(this->key(i), value) && value == this->value(i) && returnValue;
+      }
+
+      return returnValue;
+    }
+};
+#endif
@@ -0,0 +1,94 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef LAYOUT_TESTS_H
+#define LAYOUT_TESTS_H
+
+#include <EEPROM-Debug.h>
+#include <EEPROM-Storage.h>
+#include <EEPROM-Cache.h>
+#include <EEPROM-WearLeveled.h>
+#include <EEPROM-Layout.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+//
+// Variables that fit in a page are not split across pages.
+//
+typedef EEPROMLayout<10, 16, EEPROMStorage<uint32_t>, EEPROMStorage<uint32_t>, EEPROMStorage<uint32_t>> PagedLayout;
+static_assert(PagedLayout::address<0>() == 10, "The first variable is placed at the start.");
+static_assert(PagedLayout::address<1>() == 16, "A variable crossing a page is moved to the next page.");
+static_assert(PagedLayout::address<2>() == 21, "A variable within a page is packed.");
+static_assert(PagedLayout::END == 26, "The layout ends after the last variable.");
+
+template <typename T>
+class LayoutAddressTest : public RunOnceTest<T>
+{
+  public:
+    LayoutAddressTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 2; }
+
+    int onRunOnce()
+    {
+      typedef EEPROMLayout<0, 1, EEPROMStorage<T>, EEPROMCache<T, CRC16<T>>, EEPROMWearLeveled<T, 4>, EEPROMReserved<5>, EEPROMStorage<T>> Layout;
+
+      typename Layout::template Type<0> a(Layout::template at<0>(), this->_minValue);
+      typename Layout::template Type<1> b(Layout::template at<1>(), this->_minValue);
+      typename Layout::template Type<2> c(Layout::template at<2>(), this->_minValue);
+      typename Layout::template Type<4> d(Layout::template at<4>(), this->_minValue);
+
+      //
+      // The addresses have to match chaining nextAddress().
+      //
+      DEBUG_INFO("\tAddresses Match nextAddress(): ");
+      int returnValue = Assert.IsTrue(b.getAddress() == a.nextAddress() &&
+                                      c.getAddress() == b.nextAddress() &&
+                                      Layout::template address<3>() == c.nextAddress() &&
+                                      d.getAddress() == c.nextAddress() + 5 &&
+                                      Layout::END == d.nextAddress());
+
+      T values[4];
+
+      for (uint i = 0; i < 4; i++)
+      {
+        values[i] = (T)random(this->_minValue, this->_maxValue);
+      }
+
+      a = values[0];
+      b = values[1];
+      b.commit();
+      c = values[2];
+      d = values[3];
+
+      EEPROMStorage<T> restoredA(Layout::template address<0>());
+      EEPROMCache<T, CRC16<T>> restoredB(Layout::template address<1>());
+      EEPROMWearLeveled<T, 4> restoredC(Layout::template address<2>());
+      EEPROMStorage<T> restoredD(Layout::template address<4>());
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tValues: ");
+      returnValue += Assert.IsTrue(restoredA.get() == values[0] && restoredB.get() == values[1] &&
+                                   restoredC.get() == values[2] && restoredD.get() == values[3]);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+#endif
@@ -0,0 +1,160 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef LOG_TESTS_H
+#define LOG_TESTS_H
+
+#include <EEPROM-Debug.h>
+#include <EEPROM-Log.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+#define LOG_CAPACITY 8 ///< The number of slots in the test log.
+
+template <typename T>
+class LogTest : public RunOnceTest<T>
+{
+  public:
+    LogTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    #if defined(EEPROM_HOST)
+    int totalTests() { return 8; }
+    #else
+    int totalTests() { return 6; }
+    #endif
+
+    int onRunOnce()
+    {
+      EEPROMLog<T, LOG_CAPACITY> log(this->_address);
+      log.clear();
+
+      uint count = 0;
+
+      for (T value : log)
+      {
+        (void)value;
+        count++;
+      }
+
+      DEBUG_INFO("\tEmpty: ");
+      int returnValue = Assert.IsTrue(log.count() == 0 && count == 0);
+
+      for (uint i = 0; i < 3; i++)
+      {
+        log.append(this->record(i));
+      }
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tAppend Order: ");
+      returnValue += Assert.IsTrue(log.count() == 3 && this->matches(log, 0));
+
+      for (uint i = 3; i < LOG_CAPACITY + 5; i++)
+      {
+        log.append(this->record(i));
+      }
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tWrap: ");
+      returnValue += Assert.IsTrue(log.count() == LOG_CAPACITY && this->matches(log, 5));
+
+      #if defined(EEPROM_HOST)
+      //
+      // Recovery reads slot 0, about log2(Capacity) slots
+      // and at most two slots after the newest.
+      //
+      EEPROM.resetCounters();
+      EEPROMLog<T, LOG_CAPACITY> recovered(this->_address);
+      recovered.recover();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tRecovery Reads: ");
+      returnValue += Assert.IsTrue(EEPROM.totalReads() <= 6 * recovered.SLOT_LENGTH);
+      #else
+      EEPROMLog<T, LOG_CAPACITY> recovered(this->_address);
+      #endif
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tRecover: ");
+      returnValue += Assert.IsTrue(recovered.count() == LOG_CAPACITY && recovered.sequence() == log.sequence() && this->matches(recovered, 5));
+
+      recovered.append(this->record(LOG_CAPACITY + 5));
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tContinue: ");
+      returnValue += Assert.IsTrue(recovered.sequence() == (uint16_t)(log.sequence() + 1) && this->matches(recovered, 6));
+
+      //
+      // A damaged newest slot is treated as an interrupted append.
+      //
+      uint address = recovered.getAddress() + ((LOG_CAPACITY + 5) % LOG_CAPACITY) * recovered.SLOT_LENGTH + 2;
+      EEPROM.write(address, EEPROM.read(address) ^ 0x10);
+      EEPROMLog<T, LOG_CAPACITY> interrupted(this->_address);
+      T newest;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tInterrupted Append: ");
+      returnValue += Assert.IsTrue(interrupted.count() == LOG_CAPACITY - 1 && interrupted.newest(newest) && newest == this->record(LOG_CAPACITY + 4) &&
+                                   this->matches(interrupted, 6));
+
+      #if defined(EEPROM_HOST)
+      //
+      // Appends spread evenly over the slots.
+      //
+      EEPROM.resetCounters();
+
+      for (uint i = 0; i < 3 * LOG_CAPACITY; i++)
+      {
+        interrupted.append(this->record(i));
+      }
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tEven Wear: ");
+      returnValue += Assert.IsTrue(EEPROM.maxWriteCount() <= 3 && interrupted.count() == LOG_CAPACITY);
+      #endif
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+
+  protected:
+    T record(uint i)
+    {
+      return (T)(this->_minValue + i);
+    }
+
+    //
+    // Checks that the log holds consecutive records starting
+    // with the given record.
+    //
+    template <typename TLog>
+    bool matches(const TLog& log, uint first)
+    {
+      bool returnValue = true;
+      uint i = first;
+
+      for (T value : log)
+      {
+        returnValue = returnValue && (value == this->record(i));
+        i++;
+      }
+
+      return returnValue && (i - first == log.count());
+    }
+};
+#endif
\ No newline at end of file
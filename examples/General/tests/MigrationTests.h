@@ -0,0 +1,201 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef MIGRATION_TESTS_H
+#define MIGRATION_TESTS_H
+
+#include <stddef.h>
+#include <EEPROM-Debug.h>
+#include <EEPROM-Storage.h>
+#include <EEPROM-Migration.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+//
+// Version 2 inserts gain and so moves mode and table.
+//
+struct MigrationV1
+{
+  uint16_t rate;
+  uint8_t mode;
+  uint8_t table[16];
+};
+
+struct MigrationV2
+{
+  uint16_t rate;
+  uint16_t gain;
+  uint8_t mode;
+  uint8_t table[16];
+};
+
+#define MIGRATION_LENGTH (EEPROMSchema<>::LENGTH + sizeof(MigrationV2) + 1) ///< The EEPROM bytes used by the test.
+
+template <typename T>
+class MigrationTest : public RunOnceTest<T>
+{
+  public:
+    MigrationTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    #if defined(EEPROM_HOST)
+    int totalTests() { return 5; }
+    #else
+    int totalTests() { return 3; }
+    #endif
+
+    int onRunOnce()
+    {
+      uint variable = this->_address + EEPROMSchema<>::LENGTH;
+      uint16_t gain = 100;
+
+      EEPROMMigration operations[] =
+      {
+        eepromMove(variable + offsetof(MigrationV1, table), variable + offsetof(MigrationV2, table), sizeof(MigrationV1::table)),
+        eepromMove(variable + offsetof(MigrationV1, mode), variable + offsetof(MigrationV2, mode), 1),
+        eepromSet(variable + offsetof(MigrationV2, gain), &gain, sizeof(gain)),
+        eepromChecksum(variable, sizeof(MigrationV1), variable, sizeof(MigrationV2))
+      };
+
+      EEPROMMigrationStep steps[] = { { 2, operations, 4 } };
+
+      this->prepare(true);
+      EEPROMSchema<> schema(this->_address, 1);
+      bool migrated = schema.migrate(steps, 1);
+
+      DEBUG_INFO("\tMigrate: ");
+      int returnValue = Assert.IsTrue(migrated && schema.version() == 2 && this->matches(variable, gain));
+
+      //
+      // Data that was not valid stays invalid.
+      //
+      this->prepare(false);
+      EEPROMSchema<> unset(this->_address, 1);
+      unset.migrate(steps, 1);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tInvalid Data: ");
+      returnValue += Assert.IsTrue(unset.version() == 2 && !EEPROMStorage<MigrationV2>(variable).isInitialized());
+
+      #if defined(EEPROM_HOST)
+      //
+      // Nothing is written at the newest version.
+      //
+      EEPROM.resetCounters();
+      EEPROMSchema<> current(this->_address, 1);
+      current.migrate(steps, 1);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tUp To Date Writes: ");
+      returnValue += Assert.IsTrue(EEPROM.totalWrites() == 0);
+
+      //
+      // Drop the writes of the migration after every possible
+      // number of bytes and finish it on the next boot.
+      //
+      this->prepare(true);
+      EEPROM.resetCounters();
+      EEPROMSchema<>(this->_address, 1).migrate(steps, 1);
+      uint32_t writes = EEPROM.totalWrites();
+      uint resumed = 0;
+
+      for (uint32_t i = 0; i <= writes; i++)
+      {
+        this->prepare(true);
+
+        EEPROM.failAfter(i);
+        EEPROMSchema<>(this->_address, 1).migrate(steps, 1);
+        EEPROM.failAfter(EEPROMHostClass::NO_FAILURE);
+
+        EEPROMSchema<> rebooted(this->_address, 1);
+
+        if (rebooted.migrate(steps, 1) && rebooted.version() == 2 && this->matches(variable, gain))
+        {
+          resumed++;
+        }
+      }
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tResumed %u of %u Interrupted Migrations: ", resumed, writes + 1);
+      returnValue += Assert.AreEqual(resumed, (uint)(writes + 1));
+      #endif
+
+      //
+      // A step with more CHECKSUM operations than the cursor
+      // can track is rejected before anything is written.
+      //
+      EEPROMMigration checksums[EEPROMSchema<>::MAX_CHECKSUMS + 1];
+
+      for (uint i = 0; i < EEPROMSchema<>::MAX_CHECKSUMS + 1; i++)
+      {
+        checksums[i] = eepromChecksum(variable, sizeof(MigrationV1), variable, sizeof(MigrationV1));
+      }
+
+      EEPROMMigrationStep rejected[] = { { 2, checksums, EEPROMSchema<>::MAX_CHECKSUMS + 1 } };
+      this->prepare(true);
+      EEPROMSchema<> limited(this->_address, 1);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tToo Many Checksums: ");
+      returnValue += Assert.IsTrue(!limited.migrate(rejected, 1) && limited.version() == 1 &&
+                                   EEPROMStorage<MigrationV1>(variable).isInitialized());
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+
+  protected:
+    /**
+     * @brief Stores the version 1 data without a version.
+     */
+    void prepare(bool valid)
+    {
+      EEPROMUtil.fillBlock(this->_address, UNSET_VALUE, MIGRATION_LENGTH);
+      EEPROMStorage<MigrationV1> item(this->_address + EEPROMSchema<>::LENGTH);
+
+      if (valid)
+      {
+        MigrationV1 value;
+        memset(&value, 0, sizeof(value));
+        value.rate = 250;
+        value.mode = 3;
+
+        for (uint i = 0; i < sizeof(value.table); i++)
+        {
+          value.table[i] = 10 + i;
+        }
+
+        item = value;
+      }
+    }
+
+    bool matches(uint address, uint16_t gain)
+    {
+      MigrationV2 value;
+      memset(&value, 0, sizeof(value));
+      bool returnValue = EEPROMStorage<MigrationV2>(address, value).read(value) && value.rate == 250 && value.gain == gain && value.mode == 3;
+
+      for (uint i = 0; i < sizeof(value.table); i++)
+      {
+        returnValue = returnValue && value.table[i] == 10 + i;
+      }
+
+      return returnValue;
+    }
+};
+#endif
@@ -0,0 +1,146 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef MIRROR_TESTS_H
+#define MIRROR_TESTS_H
+
+//
+// These tests count the accesses to the simulated
+// EEPROM and only run on the host.
+//
+#if defined(EEPROM_HOST)
+#include <EEPROM-Debug.h>
+#include <EEPROM-Storage.h>
+#include <EEPROM-Mirror.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+typedef EEPROMMirror<EEPROM_HOST_SIZE> TestMirror;
+
+template <typename T>
+class MirrorSyncTest : public RunOnceTest<T>
+{
+  public:
+    MirrorSyncTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 5; }
+
+    int onRunOnce()
+    {
+      static TestMirror mirror;
+      mirror.begin();
+      mirror.setBudget(0);
+      mirror.setDeadline(0);
+
+      T value = (T)random(this->_minValue, this->_maxValue);
+      EEPROMStorage<T> storage(this->_address, this->_minValue);
+      EEPROM.resetCounters();
+      storage = value;
+
+      DEBUG_INFO("\tWrite Kept In RAM: ");
+      int returnValue = Assert.IsTrue(mirror.isDirty() && EEPROM.totalWrites() == 0);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tRead From RAM: ");
+      returnValue += Assert.IsTrue(storage.get() == value && EEPROM.totalReads() == 0);
+
+      mirror.end();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tSync Writes Value: ");
+      returnValue += Assert.IsTrue(!mirror.isDirty() && EEPROMStorage<T>(this->_address, this->_minValue).get() == value);
+
+      //
+      // A write that reaches the budget syncs immediately. The
+      // budget is one byte because an unchanged checksum byte
+      // is not written.
+      //
+      mirror.begin();
+      mirror.setBudget(1);
+      mirror.setDeadline(0);
+      EEPROM.resetCounters();
+      storage = (T)(value + 1);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tBudget Syncs: ");
+      returnValue += Assert.IsTrue(!mirror.isDirty() && EEPROM.totalWrites() > 0);
+
+      //
+      // A write older than the deadline is synced by poll().
+      //
+      mirror.setBudget(0);
+      mirror.setDeadline(1);
+      storage = value;
+      delay(2);
+      mirror.poll();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tDeadline Syncs: ");
+      returnValue += Assert.IsFalse(mirror.isDirty());
+
+      mirror.end();
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+template <typename T>
+class MirrorPassThroughTest : public RunOnceTest<T>
+{
+  public:
+    MirrorPassThroughTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 3; }
+
+    int onRunOnce()
+    {
+      //
+      // Only the first two pages are mirrored.
+      //
+      static EEPROMMirror<EEPROM_MIRROR_PAGE * 2> mirror;
+      mirror.begin();
+      mirror.setBudget(0);
+      mirror.setDeadline(0);
+
+      DEBUG_INFO("\tLength Not Changed: ");
+      int returnValue = Assert.AreEqual(EEPROMUtil.length(), (uint)EEPROM_HOST_SIZE);
+
+      T value = (T)random(this->_minValue, this->_maxValue);
+      uint address = this->_address + (EEPROM_MIRROR_PAGE * 2);
+      EEPROMStorage<T> storage(address, this->_minValue);
+      storage.unset();
+      storage = value;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tWrite Past Mirror: ");
+      returnValue += Assert.IsTrue(!mirror.isDirty() && memcmp(EEPROM.data() + address, &value, sizeof(T)) == 0);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tRead Past Mirror: ");
+      returnValue += Assert.IsTrue(storage.isInitialized() && storage.get() == value);
+
+      mirror.end();
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+#endif
+#endif
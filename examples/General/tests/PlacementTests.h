@@ -0,0 +1,95 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef PLACEMENT_TESTS_H
+#define PLACEMENT_TESTS_H
+
+#include <EEPROM-Debug.h>
+#include <EEPROM-Storage.h>
+#include <EEPROM-Cache.h>
+#include <EEPROM-Registry.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+//
+// Default values for the static placement.
+//
+template <typename T>
+struct PlacementDefaults
+{
+  static const T progmem;
+  static T function() { return (T)9; }
+};
+
+template <typename T>
+const T PlacementDefaults<T>::progmem PROGMEM = (T)11;
+
+template <typename T>
+class StaticPlacementTest : public RunOnceTest<T>
+{
+  public:
+    StaticPlacementTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 5; }
+
+    int onRunOnce()
+    {
+      EEPROMStaticStorage<T, 0, EEPROMConstant<T, (T)7>> a;
+      EEPROMStaticStorage<T, 8, EEPROMFunction<T, &PlacementDefaults<T>::function>> b;
+      EEPROMStaticStorage<T, 16, EEPROMProgmem<T, &PlacementDefaults<T>::progmem>> c;
+
+      a.unset();
+      b.unset();
+      c.unset();
+
+      DEBUG_INFO("\tDefault Values: ");
+      int returnValue = Assert.IsTrue(a.get() == (T)7 && b.get() == (T)9 && c.get() == (T)11);
+
+      T value = (T)random(this->_minValue, this->_maxValue);
+      a = value;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tValue Stored: ");
+      returnValue += Assert.AreEqual(EEPROMStorage<T>(0).get(), value);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tNo Address In RAM: ");
+      returnValue += Assert.IsTrue(sizeof(a) == 1 && sizeof(EEPROMStaticCache<T, 0>) < sizeof(EEPROMCache<T>));
+
+      EEPROMStaticCache<T, 8> d;
+      d = value;
+      d.commit();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCache Committed: ");
+      returnValue += Assert.AreEqual(EEPROMStorage<T>(8).get(), value);
+
+      EEPROMRegistry.clear();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tRegistry Scan: ");
+      returnValue += Assert.IsTrue(EEPROMRegistry.add(a) && EEPROMRegistry.add(c) && EEPROMRegistry.scan() == 1 && a.isInitialized());
+
+      EEPROMRegistry.clear();
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+#endif
@@ -0,0 +1,112 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef REGISTRY_TESTS_H
+#define REGISTRY_TESTS_H
+
+#include <EEPROM-Debug.h>
+#include <EEPROM-Storage.h>
+#include <EEPROM-Registry.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+//
+// Scans three variables, the middle one unset, and checks
+// that the cached results follow writes and unsets.
+//
+template <typename T>
+class RegistryScanTest : public RunOnceTest<T>
+{
+  public:
+    RegistryScanTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    #if defined(EEPROM_HOST)
+    int totalTests() { return 7; }
+    #else
+    int totalTests() { return 6; }
+    #endif
+
+    int onRunOnce()
+    {
+      EEPROMStorage<T> a(this->_address, this->_minValue);
+      EEPROMStorage<T> b(a.nextAddress(), this->_minValue);
+      EEPROMStorage<T> c(b.nextAddress(), this->_minValue);
+
+      a = (T)random(this->_minValue, this->_maxValue);
+      b.unset();
+      c = (T)random(this->_minValue, this->_maxValue);
+
+      EEPROMRegistry.clear();
+      EEPROMRegistry.add(a);
+      EEPROMRegistry.add(b);
+      EEPROMRegistry.add(c);
+
+      DEBUG_INFO("\tScan Count: ");
+      int returnValue = Assert.AreEqual(EEPROMRegistry.scan(), (uint)2);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tScan Results: ");
+      returnValue += Assert.IsTrue(a.isInitialized() && !b.isInitialized() && c.isInitialized());
+
+      #if defined(EEPROM_HOST)
+      EEPROM.resetCounters();
+      a.isInitialized();
+      b.isInitialized();
+      c.isInitialized();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCached Results Not Read: ");
+      returnValue += Assert.AreEqual(EEPROM.totalReads(), (uint32_t)0);
+      #endif
+
+      b = (T)random(this->_minValue, this->_maxValue);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tWrite Updates Result: ");
+      returnValue += Assert.IsTrue(b.isInitialized());
+
+      a.unset();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tUnset Updates Result: ");
+      returnValue += Assert.IsFalse(a.isInitialized());
+
+      //
+      // Corrupt c without using the variable.
+      //
+      EEPROMUtil.updateEEPROM(c.checksumAddress(), (byte)~EEPROMUtil.readEEPROM(c.checksumAddress()));
+      EEPROMRegistry.invalidate();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tInvalidate Rereads Result: ");
+      returnValue += Assert.IsFalse(c.isInitialized());
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tAdd Existing Variable: ");
+      EEPROMStorage<T> d(c.getAddress(), this->_minValue);
+      EEPROMRegistry.add(d);
+      returnValue += Assert.AreEqual(EEPROMRegistry.count(), (uint)3);
+
+      EEPROMRegistry.clear();
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+#endif
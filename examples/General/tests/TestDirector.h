@@ -23,6 +23,23 @@
 #include "TestResults.h"
 #include "ArithmeticTests.h"
 #include "BinaryTests.h"
+#include "AccessTests.h"
+#include "WearLeveledTests.h"
+#include "CRCTests.h"
+#include "TransactionTests.h"
+#include "LayoutTests.h"
+#include "DeviceTests.h"
+#include "ClearTests.h"
+#include "RegistryTests.h"
+#include "MirrorTests.h"
+#include "PlacementTests.h"
+#include "FieldTests.h"
+#include "ArrayTests.h"
+#include "LogTests.h"
+#include "CompressedTests.h"
+#include "CounterTests.h"
+#include "KeyValueTests.h"
+#include "MigrationTests.h"
 #include <EEPROM-Debug.h>
 
 template <typename T>
@@ -393,6 +410,470 @@ class TestDirector
       return this->_testResults;
     }
 
+    #if defined(EEPROM_HOST)
+    TestResults runAccessTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Access tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      {
+        ReadAccessTest<T> test("Read Access", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      {
+        WriteAccessTest<T> test("Write Access", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      #if defined(TARGET_CACHE)
+      {
+        CommitAccessTest<T> test("Commit Access", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+      #endif
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+    #endif
+
+    TestResults runWearLeveledTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Wear Leveled tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      //
+      // Leave room for all of the slots.
+      //
+      uint address = min(this->_address, EEPROM.length() - (WEAR_LEVELED_SLOTS * (sizeof(T) + 2)));
+
+      {
+        WearLeveledValueTest<T> test("Wear Leveled Value", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      #if defined(PARTICLE)
+      Particle.process();
+      #endif
+
+      {
+        WearLeveledTornWriteTest<T> test("Wear Leveled Torn Write", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      #if defined(EEPROM_HOST)
+      {
+        WearLeveledWearTest<T> test("Wear Leveled Wear", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+      #endif
+
+      #if defined(PARTICLE)
+      Particle.process();
+      #endif
+
+      {
+        PingPongValueTest<T> test("Ping Pong Value", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      {
+        PingPongCacheTest<T> test("Ping Pong Cache", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      #if defined(EEPROM_HOST)
+      {
+        PingPongTornWriteTest<T> test("Ping Pong Torn Write", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+      #endif
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    TestResults runCRCTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running CRC tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      {
+        CRCCheckValueTest<T> test("CRC Check Value", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      {
+        ChecksumKernelTest<T> test("Checksum Kernel", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      {
+        CRCValueTest<T> test("CRC Value", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      {
+        CRCSwapTest<T> test("CRC Swap", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      {
+        CRCReplaceTest<T> test("CRC Replace", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      //
+      // Leave room for the block and a CRC-16.
+      //
+      uint address = min(this->_address, EEPROM.length() - (sizeof(ChecksumBlock) + 2));
+
+      {
+        IncrementalWriteTest<T> test("Incremental Write", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    TestResults runTransactionTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Transaction tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      //
+      // Leave room for the variables and the journal.
+      //
+      uint address = min(this->_address, EEPROM.length() - TRANSACTION_LENGTH(T));
+
+      {
+        TransactionCommitTest<T> test("Transaction Commit", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      #if defined(EEPROM_HOST)
+      {
+        TransactionPowerCutTest<T> test("Transaction Power Cut", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+      #endif
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    TestResults runLayoutTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Layout tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      {
+        LayoutAddressTest<T> test("Layout Address", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    TestResults runClearTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Clear tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      {
+        ClearRangeTest<T> test("Clear Range", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    TestResults runPlacementTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Placement tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      {
+        StaticPlacementTest<T> test("Static Placement", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    TestResults runFieldTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Field tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      //
+      // Leave room for the structure and a CRC-16.
+      //
+      uint address = min(this->_address, EEPROM.length() - (sizeof(FieldRecord<T>) + 2));
+
+      {
+        FieldTest<T> test("Field", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    TestResults runArrayTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Array tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      //
+      // Leave room for ten elements with a checksum each.
+      //
+      uint address = min(this->_address, EEPROM.length() - 10 * (sizeof(T) + 1));
+
+      {
+        ArrayTest<T> test("Array", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    TestResults runLogTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Log tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      //
+      // Leave room for the slots of the log.
+      //
+      uint address = min(this->_address, EEPROM.length() - LOG_CAPACITY * (sizeof(T) + 3));
+
+      {
+        LogTest<T> test("Log", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    TestResults runCompressedTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Compressed tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      //
+      // Leave room for the table in the worst case.
+      //
+      uint address = min(this->_address, EEPROM.length() - EEPROMCompressed<CompressedTable<T>>::LENGTH);
+
+      {
+        CompressedTest<T> test("Compressed", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    TestResults runCounterTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Counter tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      //
+      // Leave room for the high word and both pools.
+      //
+      uint address = min(this->_address, EEPROM.length() - EEPROMCounter<T>::LENGTH);
+
+      {
+        CounterTest<T> test("Counter", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      #if defined(EEPROM_HOST)
+      {
+        CounterWearTest<T> test("Counter Wear", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+      #endif
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    TestResults runKeyValueTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Key Value tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      //
+      // Leave room for all of the entries.
+      //
+      uint address = min(this->_address, EEPROM.length() - EEPROMKeyValue<KEY_VALUE_SLOTS, sizeof(T)>::LENGTH);
+
+      {
+        KeyValueTest<T> test("Key Value", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    TestResults runMigrationTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Migration tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      //
+      // Leave room for the version and the migrated variable.
+      //
+      uint address = min(this->_address, EEPROM.length() - MIGRATION_LENGTH);
+
+      {
+        MigrationTest<T> test("Migration", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    TestResults runRegistryTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Registry tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      //
+      // Leave room for the three variables.
+      //
+      uint address = min(this->_address, EEPROM.length() - 3 * (sizeof(T) + 1));
+
+      {
+        RegistryScanTest<T> test("Registry Scan", address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+
+    #if defined(EEPROM_HOST)
+    TestResults runDeviceTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Device tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      {
+        DeviceValueTest<T> test("Device Value", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      {
+        DevicePageWriteTest<T> test("Device Page Write", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+    #endif
+
+    #if defined(EEPROM_HOST)
+    TestResults runMirrorTests()
+    {
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+      DEBUG_INFO("Running Mirror tests on Type %s.", this->_typeName);
+      DEBUG_INFO("-----------------------------------------------------------------------------------------------------------------------------");
+
+      {
+        MirrorSyncTest<T> test("Mirror Sync", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      {
+        MirrorPassThroughTest<T> test("Mirror Pass Through", this->_address, this->_minValue, this->_maxValue);
+        this->_testResults.totalTests += test.totalTests();
+        this->_testResults.totalPassed += test.runOnce();
+      }
+
+      DEBUG_INFO("");
+
+      return this->_testResults;
+    }
+    #endif
+
   protected:
     const char* _typeName;
     uint _address;
@@ -134,6 +134,204 @@ class TestRunnerClass
         returnValue.add(t.runBinaryTests());
       }
 
+      //
+      // Test the wear leveled variable.
+      //
+      {
+        TestDirector<uint32_t> t("uint32_t", address, 0, 39999);
+        returnValue.add(t.runWearLeveledTests());
+      }
+
+      {
+        TestDirector<double> t("double", address, -1500.00, 1500.99);
+        returnValue.add(t.runWearLeveledTests());
+      }
+
+      //
+      // Test the CRC checksum policies.
+      //
+      {
+        TestDirector<uint32_t> t("uint32_t", address, 0, 39999);
+        returnValue.add(t.runCRCTests());
+      }
+
+      //
+      // Test the transaction.
+      //
+      {
+        TestDirector<uint32_t> t("uint32_t", address, 0, 39999);
+        returnValue.add(t.runTransactionTests());
+      }
+
+      {
+        TestDirector<double> t("double", address, -1500.00, 1500.99);
+        returnValue.add(t.runTransactionTests());
+      }
+
+      //
+      // Test the compile time layout.
+      //
+      {
+        TestDirector<uint32_t> t("uint32_t", address, 0, 39999);
+        returnValue.add(t.runLayoutTests());
+      }
+
+      //
+      // Test clearing a range.
+      //
+      {
+        TestDirector<uint32_t> t("uint32_t", address, 0, 39999);
+        returnValue.add(t.runClearTests());
+      }
+
+      //
+      // Test the boot time scan.
+      //
+      {
+        TestDirector<uint8_t> t("uint8_t", address, 0, 200);
+        returnValue.add(t.runRegistryTests());
+      }
+
+      {
+        TestDirector<double> t("double", address, -1500.00, 1500.99);
+        returnValue.add(t.runRegistryTests());
+      }
+
+      //
+      // Test the compile time address and default value.
+      //
+      {
+        TestDirector<uint16_t> t("uint16_t", address, 0, 60000);
+        returnValue.add(t.runPlacementTests());
+      }
+
+      {
+        TestDirector<uint32_t> t("uint32_t", address, 0, 39999);
+        returnValue.add(t.runPlacementTests());
+      }
+
+      //
+      // Test access to one member of a structure.
+      //
+      {
+        TestDirector<uint16_t> t("uint16_t", address, 0, 60000);
+        returnValue.add(t.runFieldTests());
+      }
+
+      {
+        TestDirector<double> t("double", address, -1500.00, 1500.99);
+        returnValue.add(t.runFieldTests());
+      }
+
+      //
+      // Test the array container.
+      //
+      {
+        TestDirector<uint16_t> t("uint16_t", address, 0, 60000);
+        returnValue.add(t.runArrayTests());
+      }
+
+      {
+        TestDirector<double> t("double", address, -1500.00, 1500.99);
+        returnValue.add(t.runArrayTests());
+      }
+
+      //
+      // Test the circular log.
+      //
+      {
+        TestDirector<uint16_t> t("uint16_t", address, 0, 60000);
+        returnValue.add(t.runLogTests());
+      }
+
+      {
+        TestDirector<double> t("double", address, -1500.00, 1500.99);
+        returnValue.add(t.runLogTests());
+      }
+
+      //
+      // Test the compressed variable.
+      //
+      {
+        TestDirector<uint16_t> t("uint16_t", address, 0, 60000);
+        returnValue.add(t.runCompressedTests());
+      }
+
+      {
+        TestDirector<double> t("double", address, -1500.00, 1500.99);
+        returnValue.add(t.runCompressedTests());
+      }
+
+      //
+      // Test the bit clearing counter.
+      //
+      {
+        TestDirector<uint16_t> t("uint16_t", address, 0, 60000);
+        returnValue.add(t.runCounterTests());
+      }
+
+      {
+        TestDirector<uint32_t> t("uint32_t", address, 0, 39999);
+        returnValue.add(t.runCounterTests());
+      }
+
+      //
+      // Test the key value store.
+      //
+      {
+        TestDirector<uint16_t> t("uint16_t", address, 0, 60000);
+        returnValue.add(t.runKeyValueTests());
+      }
+
+      {
+        TestDirector<double> t("double", address, -1500.00, 1500.99);
+        returnValue.add(t.runKeyValueTests());
+      }
+
+      //
+      // Test the layout migration.
+      //
+      {
+        TestDirector<uint8_t> t("uint8_t", address, 0, 200);
+        returnValue.add(t.runMigrationTests());
+      }
+
+      //
+      // Count the EEPROM accesses on the host.
+      //
+      #if defined(EEPROM_HOST)
+      {
+        TestDirector<uint8_t> t("uint8_t", address, 0, 200);
+        returnValue.add(t.runAccessTests());
+      }
+
+      {
+        TestDirector<uint32_t> t("uint32_t", address, 0, 39999);
+        returnValue.add(t.runAccessTests());
+      }
+
+      {
+        TestDirector<double> t("double", address, -1500.00, 1500.99);
+        returnValue.add(t.runAccessTests());
+      }
+
+      //
+      // Test the simulated external EEPROM.
+      //
+      {
+        TestDirector<uint32_t> t("uint32_t", address, 0, 39999);
+        returnValue.add(t.runDeviceTests());
+      }
+
+      //
+      // Test the RAM mirror.
+      //
+      {
+        TestDirector<uint32_t> t("uint32_t", address, 0, 39999);
+        returnValue.add(t.runMirrorTests());
+      }
+      #endif
+
       return returnValue;
     }
 
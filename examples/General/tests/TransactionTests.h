@@ -0,0 +1,216 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef TRANSACTION_TESTS_H
+#define TRANSACTION_TESTS_H
+
+#include <EEPROM-Debug.h>
+#include <EEPROM-Cache.h>
+#include <EEPROM-Transaction.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+#define TRANSACTION_VARIABLES 3
+#define TRANSACTION_JOURNAL_LENGTH 64
+
+//
+// The number of EEPROM bytes used by the transaction tests.
+//
+#define TRANSACTION_LENGTH(T) ((TRANSACTION_VARIABLES * (sizeof(T) + 1)) + TRANSACTION_JOURNAL_LENGTH)
+
+template <typename T>
+class TransactionCommitTest : public RunOnceTest<T>
+{
+  public:
+    TransactionCommitTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 3; }
+
+    int onRunOnce()
+    {
+      int returnValue = 0;
+      T values[TRANSACTION_VARIABLES];
+      uint journal = this->_address + (TRANSACTION_VARIABLES * (sizeof(T) + 1));
+
+      {
+        EEPROMCache<T> a(this->_address, this->_minValue);
+        EEPROMCache<T> b(a.nextAddress(), this->_minValue);
+        EEPROMCache<T> c(b.nextAddress(), this->_minValue);
+
+        EEPROMTransaction transaction(journal, TRANSACTION_JOURNAL_LENGTH);
+        transaction.add(a);
+        transaction.add(b);
+        transaction.add(c);
+        transaction.recover();
+
+        a = values[0] = (T)random(this->_minValue, this->_maxValue);
+        b = values[1] = (T)random(this->_minValue, this->_maxValue);
+        c = values[2] = (T)random(this->_minValue, this->_maxValue);
+
+        DEBUG_INFO("\tCommitted: ");
+        returnValue += Assert.IsTrue(transaction.commit() && !a.isDirty() && !b.isDirty() && !c.isDirty());
+      }
+
+      //
+      // New instances have to read the committed values.
+      //
+      EEPROMCache<T> a(this->_address);
+      EEPROMCache<T> b(a.nextAddress());
+      EEPROMCache<T> c(b.nextAddress());
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tValues: ");
+      returnValue += Assert.IsTrue(a.get() == values[0] && b.get() == values[1] && c.get() == values[2]);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tJournal Cleared: ");
+      returnValue += Assert.AreEqual(EEPROM.read(journal), (byte)UNSET_VALUE);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+//
+// Cuts the power after every possible number of writes of a
+// commit and checks that recover() leaves either all of the
+// old values or all of the new values.
+//
+#if defined(EEPROM_HOST)
+template <typename T>
+class TransactionPowerCutTest : public RunOnceTest<T>
+{
+  public:
+    TransactionPowerCutTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 2; }
+
+    int onRunOnce()
+    {
+      T oldValues[TRANSACTION_VARIABLES];
+      T newValues[TRANSACTION_VARIABLES];
+
+      for (uint i = 0; i < TRANSACTION_VARIABLES; i++)
+      {
+        oldValues[i] = (T)random(this->_minValue, this->_maxValue);
+
+        do
+        {
+          newValues[i] = (T)random(this->_minValue, this->_maxValue);
+        } while (newValues[i] == oldValues[i]);
+      }
+
+      //
+      // Count the writes of a complete commit.
+      //
+      this->prepare(oldValues);
+      uint32_t before = EEPROM.totalWrites();
+      this->interrupt(newValues, EEPROMHostClass::NO_FAILURE);
+      uint32_t writes = EEPROM.totalWrites() - before;
+
+      bool consistent = true;
+      bool completed = false;
+
+      for (uint32_t n = 0; n <= writes; n++)
+      {
+        this->prepare(oldValues);
+        this->interrupt(newValues, n);
+
+        //
+        // Power is back, recover and compare.
+        //
+        EEPROMCache<T> a(this->_address);
+        EEPROMCache<T> b(a.nextAddress());
+        EEPROMCache<T> c(b.nextAddress());
+        EEPROMTransaction transaction(this->journalAddress(), TRANSACTION_JOURNAL_LENGTH);
+        transaction.add(a);
+        transaction.add(b);
+        transaction.add(c);
+        transaction.recover();
+
+        bool allOld = a.get() == oldValues[0] && b.get() == oldValues[1] && c.get() == oldValues[2];
+        bool allNew = a.get() == newValues[0] && b.get() == newValues[1] && c.get() == newValues[2];
+
+        if (!allOld && !allNew)
+        {
+          DEBUG_INFO("\tInconsistent values after %u of %u writes.", n, writes);
+          consistent = false;
+        }
+
+        completed = allNew;
+      }
+
+      DEBUG_INFO("\tConsistent After Every Power Cut (%u writes): ", writes);
+      int returnValue = Assert.IsTrue(consistent);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tNew Values After Complete Commit: ");
+      returnValue += Assert.IsTrue(completed);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+
+  protected:
+    uint journalAddress()
+    {
+      return this->_address + (TRANSACTION_VARIABLES * (sizeof(T) + 1));
+    }
+
+    /**
+     * @brief Commits the old values without a power cut.
+     */
+    void prepare(T* values)
+    {
+      EEPROM.failAfter(EEPROMHostClass::NO_FAILURE);
+
+      EEPROMCache<T> a(this->_address, values[0]);
+      EEPROMCache<T> b(a.nextAddress(), values[1]);
+      EEPROMCache<T> c(b.nextAddress(), values[2]);
+      EEPROMTransaction transaction(this->journalAddress(), TRANSACTION_JOURNAL_LENGTH);
+      transaction.add(a);
+      transaction.add(b);
+      transaction.add(c);
+      transaction.commit();
+    }
+
+    /**
+     * @brief Commits the new values and loses power after the given number of writes.
+     */
+    void interrupt(T* values, uint32_t writes)
+    {
+      EEPROMCache<T> a(this->_address);
+      EEPROMCache<T> b(a.nextAddress());
+      EEPROMCache<T> c(b.nextAddress());
+      EEPROMTransaction transaction(this->journalAddress(), TRANSACTION_JOURNAL_LENGTH);
+      transaction.add(a);
+      transaction.add(b);
+      transaction.add(c);
+
+      a = values[0];
+      b = values[1];
+      c = values[2];
+
+      EEPROM.failAfter(writes);
+      transaction.commit();
+      EEPROM.failAfter(EEPROMHostClass::NO_FAILURE);
+    }
+};
+#endif
+#endif
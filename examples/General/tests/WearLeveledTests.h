@@ -0,0 +1,335 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef WEAR_LEVELED_TESTS_H
+#define WEAR_LEVELED_TESTS_H
+
+#include <EEPROM-Debug.h>
+#include <EEPROM-Storage.h>
+#include <EEPROM-WearLeveled.h>
+#include "RunOnceTest.h"
+#include "Assert.h"
+
+#define WEAR_LEVELED_SLOTS 8
+
+template <typename T>
+class WearLeveledValueTest : public RunOnceTest<T>
+{
+  public:
+    WearLeveledValueTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 4; }
+
+    int onRunOnce()
+    {
+      //
+      // Start with empty slots.
+      //
+      EEPROMWearLeveled<T, WEAR_LEVELED_SLOTS> item(this->_address, this->_minValue);
+      item.unset();
+
+      DEBUG_INFO("\tNot Initialized: ");
+      int returnValue = Assert.IsFalse(item.isInitialized());
+
+      //
+      // Write more values than there are slots so the ring wraps.
+      //
+      T value = this->_minValue;
+
+      for (uint i = 0; i < (WEAR_LEVELED_SLOTS * 3) + 1; i++)
+      {
+        value = (T)random(this->_minValue, this->_maxValue);
+        item = value;
+      }
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tValue After Wrap: ");
+      returnValue += Assert.AreEqual(item.get(), value);
+
+      //
+      // A new instance has to find the newest slot.
+      //
+      EEPROMWearLeveled<T, WEAR_LEVELED_SLOTS> restored(this->_address, this->_minValue);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tValue After Scan: ");
+      returnValue += Assert.AreEqual(restored.get(), value);
+
+      //
+      // read() and write() use the slots like get() and set().
+      //
+      restored.write(this->_maxValue);
+      EEPROMWearLeveled<T, WEAR_LEVELED_SLOTS> reread(this->_address, this->_minValue);
+      T stored = this->_minValue;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tRead After Write: ");
+      returnValue += Assert.IsTrue(reread.read(stored) && stored == this->_maxValue);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+template <typename T>
+class WearLeveledTornWriteTest : public RunOnceTest<T>
+{
+  public:
+    WearLeveledTornWriteTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 1; }
+
+    int onRunOnce()
+    {
+      EEPROMWearLeveled<T, WEAR_LEVELED_SLOTS> item(this->_address, this->_minValue);
+      item.unset();
+
+      for (uint i = 0; i < WEAR_LEVELED_SLOTS + 2; i++)
+      {
+        item = this->_maxValue;
+      }
+
+      item = this->_minValue;
+
+      //
+      // Corrupt the checksum of the newest slot as if
+      // the device was reset during the write.
+      //
+      uint slotLength = sizeof(T) + 2;
+      uint checksumAddress = item.getAddress() + (item.activeSlot() * slotLength) + slotLength - 1;
+      EEPROM.write(checksumAddress, EEPROM.read(checksumAddress) ^ 0x01);
+
+      //
+      // A new instance has to fall back to the previous slot.
+      //
+      EEPROMWearLeveled<T, WEAR_LEVELED_SLOTS> restored(this->_address, this->_minValue);
+
+      DEBUG_INFO("\tPrevious Value Restored: ");
+      int returnValue = Assert.AreEqual(restored.get(), this->_maxValue);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+template <typename T>
+class PingPongValueTest : public RunOnceTest<T>
+{
+  public:
+    PingPongValueTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 2; }
+
+    int onRunOnce()
+    {
+      EEPROMPingPong<T> item(this->_address, this->_minValue);
+      item.unset();
+
+      DEBUG_INFO("\tLength: ");
+      int returnValue = Assert.AreEqual(item.length(), (uint)(2 * (sizeof(T) + 2)));
+
+      T value = (T)random(this->_minValue, this->_maxValue);
+      item = this->_maxValue;
+      item = value;
+
+      //
+      // A new instance has to find the newest copy.
+      //
+      EEPROMPingPong<T> restored(this->_address, this->_minValue);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tValue After Scan: ");
+      returnValue += Assert.AreEqual(restored.get(), value);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+template <typename T>
+class PingPongCacheTest : public RunOnceTest<T>
+{
+  public:
+    PingPongCacheTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 5; }
+
+    int onRunOnce()
+    {
+      EEPROMPingPong<T> storage(this->_address, this->_minValue);
+      storage.unset();
+      storage = this->_minValue;
+
+      //
+      // A set() is only written by commit().
+      //
+      EEPROMPingPongCache<T> item(this->_address, this->_maxValue);
+      T value = (T)random(this->_minValue, this->_maxValue);
+      item = this->_maxValue;
+      item = value;
+
+      EEPROMPingPong<T> before(this->_address, this->_maxValue);
+
+      DEBUG_INFO("\tValue Before Commit: ");
+      int returnValue = Assert.AreEqual(before.get(), this->_minValue);
+
+      item.commit();
+      EEPROMPingPong<T> after(this->_address, this->_minValue);
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tValue After Commit: ");
+      returnValue += Assert.AreEqual(after.get(), value);
+
+      //
+      // Setting the same value leaves nothing to commit.
+      //
+      item = value;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tSame Value Not Dirty: ");
+      returnValue += Assert.IsFalse(item.isDirty());
+
+      //
+      // Assigning another variable copies its value,
+      // which is also only written by commit().
+      //
+      EEPROMPingPongCache<T> other(this->_address + storage.length(), this->_minValue);
+      other = this->_maxValue;
+      item = other;
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCopy Before Commit: ");
+      returnValue += Assert.AreEqual(EEPROMPingPong<T>(this->_address, this->_minValue).get(), value);
+
+      item.commit();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tCopy After Commit: ");
+      returnValue += Assert.AreEqual(EEPROMPingPong<T>(this->_address, this->_minValue).get(), this->_maxValue);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+//
+// Compares the highest number of writes to any single cell
+// using the access counters of the simulated EEPROM.
+//
+#if defined(EEPROM_HOST)
+template <typename T>
+class WearLeveledWearTest : public RunOnceTest<T>
+{
+  public:
+    WearLeveledWearTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 1; }
+
+    int onRunOnce()
+    {
+      const uint increments = 800;
+
+      EEPROMStorage<T> storage(this->_address, this->_minValue);
+      storage = this->_minValue;
+      EEPROM.resetCounters();
+
+      for (uint i = 0; i < increments; i++)
+      {
+        storage++;
+      }
+
+      uint32_t storageWear = EEPROM.maxWriteCount();
+
+      EEPROMWearLeveled<T, WEAR_LEVELED_SLOTS> item(this->_address, this->_minValue);
+      item.unset();
+      item = this->_minValue;
+      EEPROM.resetCounters();
+
+      for (uint i = 0; i < increments; i++)
+      {
+        item++;
+      }
+
+      uint32_t leveledWear = EEPROM.maxWriteCount();
+
+      DEBUG_INFO("\tHighest cell write count %u (EEPROMStorage) vs %u (EEPROMWearLeveled): ", storageWear, leveledWear);
+      int returnValue = Assert.IsTrue((leveledWear * WEAR_LEVELED_SLOTS) <= (storageWear + WEAR_LEVELED_SLOTS));
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+
+//
+// Drops the writes of an update after every possible number of
+// bytes and checks that the old or the new value is always read back.
+//
+template <typename T>
+class PingPongTornWriteTest : public RunOnceTest<T>
+{
+  public:
+    PingPongTornWriteTest(const char* name, uint address, T minValue, T maxValue) : RunOnceTest<T>(name, address, minValue, maxValue) {}
+
+    int totalTests() { return 2; }
+
+    int onRunOnce()
+    {
+      uint slotLength = sizeof(T) + 2;
+      uint survived = 0;
+
+      for (uint i = 0; i <= slotLength; i++)
+      {
+        EEPROMPingPong<T> item(this->_address, this->_minValue);
+        item.unset();
+        item = this->_maxValue;
+
+        EEPROM.failAfter(i);
+        item = this->_minValue;
+        EEPROM.failAfter(EEPROMHostClass::NO_FAILURE);
+
+        EEPROMPingPong<T> restored(this->_address, this->_maxValue);
+        T value = restored.get();
+
+        if (restored.isInitialized() && (value == this->_minValue || value == this->_maxValue))
+        {
+          survived++;
+        }
+      }
+
+      DEBUG_INFO("\tValue Survived %u of %u Torn Writes: ", survived, slotLength + 1);
+      int returnValue = Assert.AreEqual(survived, slotLength + 1);
+
+      //
+      // Once the newest copy is known a read touches only that copy.
+      //
+      EEPROMPingPong<T> item(this->_address, this->_minValue);
+      item.get();
+      EEPROM.resetCounters();
+      item.get();
+
+      DEBUG_INFO("");
+      DEBUG_INFO("\tReads After Scan %u: ", EEPROM.totalReads());
+      returnValue += Assert.IsTrue(EEPROM.totalReads() <= slotLength);
+
+      this->_totalPassed += returnValue;
+      return returnValue;
+    }
+};
+#endif
+#endif
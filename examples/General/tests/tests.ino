@@ -25,8 +25,15 @@
 // Uncomment one or the other to select
 // the library to test.
 //
+#if !defined(TARGET_STORAGE) && !defined(TARGET_CACHE)
 #define TARGET_STORAGE
 //#define TARGET_CACHE
+#endif
+
+//
+// The registry tests need EEPROMRegistry.
+//
+#define EEPROM_USE_REGISTRY true
 
 #include <EEPROM-Util.h>
 #include "TestRunner.h"
@@ -50,6 +57,12 @@ int _isCompleted = 0;
 int _totalTests = 0;
 int _passedTests = 0;
 int _failedTests = 0;
+#elif defined(EEPROM_HOST)
+//
+// The number of failed tests is used as the
+// exit code of the host build.
+//
+int _failedTests = 0;
 #endif
 
 void setup() 
@@ -115,6 +128,8 @@ void setup()
   _totalTests = results.totalTests;
   _passedTests = results.totalPassed;
   _failedTests = results.totalFailed();
+  #elif defined(EEPROM_HOST)
+  _failedTests = results.totalFailed();
   #endif
 }
 
@@ -0,0 +1,123 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+
+// ---------------------------------------------------------------------------------------
+// Displays the placement of EEPROM variables in memory when using EEPROMLayout. The
+// addresses are computed at compile time and a layout that does not fit in the EEPROM
+// does not compile.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-Layout.h>
+#include <EEPROM-Display.h>
+#include <EEPROM-Debug.h>
+
+//
+// Define the EEPROM layout.
+//
+typedef EEPROMLayout<0, 1,
+                     EEPROMStorage<uint8_t>,
+                     EEPROMStorage<uint16_t>,
+                     EEPROMStorage<uint32_t>,
+                     EEPROMStorage<uint64_t>,
+                     EEPROMStorage<float>,
+                     EEPROMStorage<double>,
+                     EEPROMStorage<char>> Layout;
+
+void setup()
+{
+  //
+  // Initialize the serial port.
+  //
+  Serial.begin(115200);
+
+  //
+  // Wait for serial port to connect. Needed
+  // for native USB port only
+  //
+  while (!Serial);
+  DEBUG_INFO("\r\n");
+
+  //
+  // On ESP8266 platforms EEPROM must be initialized.
+  //
+  #if defined(ESP8266)
+  EEPROM.begin(4096);
+  #endif
+
+  //
+  // Display the EEPROM size.
+  //
+  DEBUG_INFO("The total size of EEPROM on this device is %d bytes", EEPROM.length());
+  
+  //
+  // Clear EEPROM.
+  //
+  EEPROMUtil.clearEEPROM();
+
+  //
+  // Define the EEPROM variables.
+  //
+  Layout::Type<0> a(Layout::at<0>(), 0);
+  Layout::Type<1> b(Layout::at<1>(), 0);
+  Layout::Type<2> c(Layout::at<2>(), 0);
+  Layout::Type<3> d(Layout::at<3>(), 0);
+  Layout::Type<4> e(Layout::at<4>(), 0);
+  Layout::Type<5> f(Layout::at<5>(), 0);
+  Layout::Type<6> g(Layout::at<6>(), ' ');
+
+  DEBUG_INFO("The layout uses %d bytes", Layout::LENGTH);
+
+  //
+  // Initialize the random number generator.
+  //
+  randomSeed(analogRead(0));
+
+  //
+  // Set random values to each EEPROM variable.
+  //
+  a = random(1, 255);
+  b = random(1, 1000);
+  c = random(1, 10000);
+  d = random(1, 100000);
+  e = random(1, 100);
+  f = random(1, 100);
+  g = 'y';
+
+  //
+  // Display the EEPROM properties.
+  //
+  EEPROMDisplay.displayHeader();
+  EEPROMDisplay.displayVariable("a", a);
+  EEPROMDisplay.displayVariable("b", b);
+  EEPROMDisplay.displayVariable("c", c);
+  EEPROMDisplay.displayVariable("d", d);
+  EEPROMDisplay.displayVariable("e", e);
+  EEPROMDisplay.displayVariable("f", f);
+  EEPROMDisplay.displayVariable("g", g);
+
+  //
+  // Display the EEPROM contents.
+  //
+  EEPROMDisplay.displayEEPROM();
+}
+
+void loop()
+{
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+
+// ---------------------------------------------------------------------------------------
+// Counts the number of times loop() has run using an EEPROMMirror. The counter is
+// incremented in RAM and written to EEPROM at most once a second, or immediately
+// when 64 bytes have been written. On ESP8266 and ESP32 the mirror also calls
+// EEPROM.commit() so that the writes are saved to flash.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-Mirror.h>
+#include <EEPROM-Debug.h>
+
+//
+// Mirror the first 512 bytes of the EEPROM in RAM.
+//
+EEPROMMirror<512> mirror;
+
+//
+// The number of times loop() has run.
+//
+EEPROMStorage<uint32_t> counter(0, 0);
+
+void setup()
+{
+  //
+  // Initialize the serial port.
+  //
+  Serial.begin(115200);
+
+  //
+  // Wait for serial port to connect. Needed
+  // for native USB port only
+  //
+  while (!Serial);
+  DEBUG_INFO("\r\n");
+
+  //
+  // On ESP8266 platforms EEPROM must be initialized.
+  //
+  #if defined(ESP8266)
+  EEPROM.begin(4096);
+  #endif
+
+  //
+  // Load the mirror and set when it writes to EEPROM.
+  //
+  mirror.setDeadline(1000);
+  mirror.setBudget(64);
+  mirror.begin();
+
+  DEBUG_INFO("The counter starts at %lu.", (unsigned long)counter.get());
+}
+
+void loop()
+{
+  //
+  // Only RAM is changed here.
+  //
+  counter++;
+
+  //
+  // Write the changes once the deadline has passed.
+  //
+  mirror.poll();
+
+  if (counter % 1000 == 0)
+  {
+    DEBUG_INFO("The counter is %lu, %u bytes not saved yet.", (unsigned long)counter.get(), mirror.pending());
+  }
+}
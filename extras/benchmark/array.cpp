@@ -0,0 +1,96 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+// ---------------------------------------------------------------------------------------
+// Measures the EEPROM accesses of reading and writing one element of 32 records of
+// 8 bytes stored as one EEPROMStorage with a single checksum compared to an
+// EEPROMArray with a checksum per element and per block of 8 elements.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-Array.h>
+
+#define COUNT 32
+
+//
+// An 8 byte record.
+//
+struct Record
+{
+  uint32_t time;
+  int16_t value;
+  uint16_t flags;
+};
+
+//
+// The records as one value.
+//
+struct Records
+{
+  Record items[COUNT];
+};
+
+/**
+ * @brief Runs an operation and prints the EEPROM accesses and length.
+ */
+template <typename TOperation>
+void measure(const char* name, uint length, TOperation operation)
+{
+  EEPROM.resetCounters();
+  operation();
+  printf("| %-34s | %6u | %8lu | %8lu |\n", name, length, (unsigned long)EEPROM.totalReads(), (unsigned long)EEPROM.totalWrites());
+}
+
+int main()
+{
+  Records initial;
+  memset(&initial, 0, sizeof(initial));
+  Record record = { 1000, -5, 3 };
+  uint32_t total = 0;
+
+  EEPROMStorage<Records> storage(0, initial);
+  EEPROMArray<Record, COUNT> elements(0, Record());
+  EEPROMArray<Record, COUNT, 8> blocks(0, Record());
+
+  printf("| %-34s | %6s | %8s | %8s |\n", "Operation", "Length", "Reads", "Writes");
+  printf("|------------------------------------|--------|----------|----------|\n");
+
+  storage = initial;
+  measure("EEPROMStorage<Records> get item 7", storage.length(), [&]() { total += storage.get().items[7].time; });
+  measure("EEPROMStorage<Records> set item 7", storage.length(), [&]()
+  {
+    Records value = storage.get();
+    value.items[7] = record;
+    storage = value;
+  });
+
+  elements.fill(Record());
+  measure("EEPROMArray<Record, 32> get [7]", elements.length(), [&]() { total += elements.get(7).time; });
+  measure("EEPROMArray<Record, 32> set [7]", elements.length(), [&]() { elements[7] = record; });
+  measure("EEPROMArray<Record, 32> iterate", elements.length(), [&]() { for (Record r : elements) total += r.time; });
+
+  blocks.fill(Record());
+  measure("EEPROMArray<Record, 32, 8> get [7]", blocks.length(), [&]() { total += blocks.get(7).time; });
+  measure("EEPROMArray<Record, 32, 8> set [7]", blocks.length(), [&]() { blocks[7] = record; });
+  measure("EEPROMArray<Record, 32, 8> iterate", blocks.length(), [&]() { for (Record r : blocks) total += r.time; });
+
+  printf("\n%u\n", total);
+  return 0;
+}
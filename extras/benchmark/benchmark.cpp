@@ -0,0 +1,256 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+
+// ---------------------------------------------------------------------------------------
+// Measures the EEPROM traffic and host CPU cost of every operation on EEPROMStorage<T>
+// and EEPROMCache<T> using the access counters of the simulated EEPROM. For each
+// operation the bytes read, bytes written and cells actually changed are reported per
+// call along with the host time in nanoseconds per call.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-Cache.h>
+#include "../../examples/Storage/advanced-structure/struct.h"
+
+#include <chrono>
+
+//
+// The number of times each operation is run.
+//
+#ifndef ITERATIONS
+  #define ITERATIONS 1000
+#endif
+
+//
+// The address used for all variables.
+//
+#define ADDRESS 100
+
+//
+// Prevents the compiler from removing reads.
+//
+static volatile byte _sink;
+
+template <typename T>
+void consume(T const& value)
+{
+  _sink = *(const byte*)&value;
+}
+
+/**
+ * @brief Runs setup() and then measures operation() ITERATIONS times.
+ * @details Only the EEPROM accesses and the time of operation() are
+ * counted, setup() is used to put the variable in a known state.
+ */
+template <typename TSetup, typename TOperation>
+void measure(const char* library, const char* typeName, const char* operation, TSetup setup, TOperation run)
+{
+  uint64_t reads = 0;
+  uint64_t writes = 0;
+  uint64_t changes = 0;
+  uint64_t nanoseconds = 0;
+
+  for (uint i = 0; i < ITERATIONS; i++)
+  {
+    setup(i);
+
+    uint32_t startReads = EEPROM.totalReads();
+    uint32_t startWrites = EEPROM.totalWrites();
+    uint32_t startChanges = EEPROM.totalChanges();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    run(i);
+
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+    nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    reads += EEPROM.totalReads() - startReads;
+    writes += EEPROM.totalWrites() - startWrites;
+    changes += EEPROM.totalChanges() - startChanges;
+  }
+
+  printf("| %-18s | %-14s | %-11s | %8.2f | %8.2f | %8.2f | %10.1f |\n", library, typeName, operation,
+         (double)reads / ITERATIONS, (double)writes / ITERATIONS, (double)changes / ITERATIONS, (double)nanoseconds / ITERATIONS);
+}
+
+/**
+ * @brief Generates a test value for iteration i.
+ */
+template <typename T>
+T valueOf(uint i)
+{
+  return (T)((i % 50) + 1);
+}
+
+template <>
+Matrix valueOf<Matrix>(uint i)
+{
+  Matrix returnValue;
+  memset(&returnValue, 0, sizeof(Matrix));
+  returnValue.sa = i;
+  returnValue.sb = i * 3;
+  returnValue.sc = i * 7;
+  returnValue.sd = 'a' + (i % 26);
+  returnValue.se = i / 3.0;
+  returnValue.sf = i / 7.0;
+  return returnValue;
+}
+
+//
+// Benchmarks common to every type and both libraries.
+//
+template <typename TVariable, typename T>
+void runCommon(const char* library, const char* typeName, TVariable& item)
+{
+  byte buffer[sizeof(T) + 1];
+
+  measure(library, typeName, "get", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(item.get()); });
+  measure(library, typeName, "set", [&](uint i) { item = valueOf<T>(i); }, [&](uint i) { consume(item.set(valueOf<T>(i + 1))); });
+  measure(library, typeName, "unset", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { item.unset(); });
+  measure(library, typeName, "copyTo", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { item.copyTo(buffer, item.length()); });
+}
+
+//
+// Benchmarks specific to EEPROMCache<T>.
+//
+template <typename T>
+void runCache(const char* typeName, EEPROMCache<T>& item)
+{
+  measure("EEPROMCache<T>", typeName, "commit", [&](uint i) { item = valueOf<T>(i); item.commit(); item = valueOf<T>(i + 1); }, [&](uint) { consume(item.commit()); });
+  measure("EEPROMCache<T>", typeName, "commit-same", [&](uint i) { item = valueOf<T>(i); item.commit(); }, [&](uint) { consume(item.commit()); });
+  measure("EEPROMCache<T>", typeName, "restore", [&](uint i) { item = valueOf<T>(i); item.commit(); }, [&](uint) { consume(item.restore()); });
+}
+
+//
+// Benchmarks the arithmetic operators.
+//
+template <typename TVariable, typename T>
+void runArithmetic(const char* library, const char* typeName, TVariable& item)
+{
+  measure(library, typeName, "x++", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(item++); });
+  measure(library, typeName, "++x", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(++item); });
+  measure(library, typeName, "x--", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(item--); });
+  measure(library, typeName, "--x", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(--item); });
+  measure(library, typeName, "+=", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(item += (T)3); });
+  measure(library, typeName, "-=", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(item -= (T)3); });
+  measure(library, typeName, "*=", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(item *= (T)2); });
+  measure(library, typeName, "/=", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(item /= (T)2); });
+}
+
+//
+// Benchmarks the integer only operators.
+//
+template <typename TVariable, typename T>
+void runBinary(const char* library, const char* typeName, TVariable& item)
+{
+  measure(library, typeName, "%=", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(item %= (T)7); });
+  measure(library, typeName, "^=", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(item ^= (T)0x55); });
+  measure(library, typeName, "&=", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(item &= (T)0x0F); });
+  measure(library, typeName, "|=", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(item |= (T)0x40); });
+  measure(library, typeName, "<<=", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(item <<= (T)1); });
+  measure(library, typeName, ">>=", [&](uint i) { item = valueOf<T>(i); }, [&](uint) { consume(item >>= (T)1); });
+}
+
+//
+// Runs every benchmark that applies to an integer type.
+//
+template <typename T>
+void runInteger(const char* typeName)
+{
+  {
+    EEPROMStorage<T> item(ADDRESS);
+    runCommon<EEPROMStorage<T>, T>("EEPROMStorage<T>", typeName, item);
+    runArithmetic<EEPROMStorage<T>, T>("EEPROMStorage<T>", typeName, item);
+    runBinary<EEPROMStorage<T>, T>("EEPROMStorage<T>", typeName, item);
+  }
+
+  {
+    EEPROMCache<T> item(ADDRESS);
+    runCommon<EEPROMCache<T>, T>("EEPROMCache<T>", typeName, item);
+    runCache<T>(typeName, item);
+    runArithmetic<EEPROMCache<T>, T>("EEPROMCache<T>", typeName, item);
+    runBinary<EEPROMCache<T>, T>("EEPROMCache<T>", typeName, item);
+  }
+}
+
+//
+// Runs every benchmark that applies to a floating point type.
+//
+template <typename T>
+void runFloatingPoint(const char* typeName)
+{
+  {
+    EEPROMStorage<T> item(ADDRESS);
+    runCommon<EEPROMStorage<T>, T>("EEPROMStorage<T>", typeName, item);
+    runArithmetic<EEPROMStorage<T>, T>("EEPROMStorage<T>", typeName, item);
+  }
+
+  {
+    EEPROMCache<T> item(ADDRESS);
+    runCommon<EEPROMCache<T>, T>("EEPROMCache<T>", typeName, item);
+    runCache<T>(typeName, item);
+    runArithmetic<EEPROMCache<T>, T>("EEPROMCache<T>", typeName, item);
+  }
+}
+
+//
+// Runs every benchmark that applies to a structure.
+//
+template <typename T>
+void runStructure(const char* typeName)
+{
+  {
+    EEPROMStorage<T> item(ADDRESS);
+    runCommon<EEPROMStorage<T>, T>("EEPROMStorage<T>", typeName, item);
+  }
+
+  {
+    EEPROMCache<T> item(ADDRESS);
+    runCommon<EEPROMCache<T>, T>("EEPROMCache<T>", typeName, item);
+    runCache<T>(typeName, item);
+  }
+}
+
+int main()
+{
+  printf("| %-18s | %-14s | %-11s | %8s | %8s | %8s | %10s |\n", "Library", "Type", "Operation", "Read/op", "Write/op", "Cells/op", "ns/op");
+  printf("|--------------------|----------------|-------------|----------|----------|----------|------------|\n");
+
+  runInteger<bool>("bool");
+  runInteger<char>("char");
+  runInteger<unsigned char>("unsigned char");
+  runInteger<int>("int");
+  runInteger<unsigned int>("unsigned int");
+  runInteger<long>("long");
+  runInteger<unsigned long>("unsigned long");
+  runInteger<short>("short");
+  runInteger<unsigned short>("unsigned short");
+  runInteger<int8_t>("int8_t");
+  runInteger<uint8_t>("uint8_t");
+  runInteger<int16_t>("int16_t");
+  runInteger<uint16_t>("uint16_t");
+  runInteger<int32_t>("int32_t");
+  runInteger<uint32_t>("uint32_t");
+  runFloatingPoint<float>("float");
+  runFloatingPoint<double>("double");
+  runStructure<Matrix>("Matrix");
+
+  return 0;
+}
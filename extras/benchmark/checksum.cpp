@@ -0,0 +1,160 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+
+// ---------------------------------------------------------------------------------------
+// Measures the host CPU cost per byte of the XOR checksum and of each CRC engine in
+// each implementation (full table, nibble table and bitwise) for several payload
+// sizes. The table size column is the flash used by the lookup table. A second table
+// compares the byte at a time and word at a time XOR kernels from EEPROM memory and
+// fails if they do not produce the same checksum.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-CRC.h>
+
+//
+// The number of bytes hashed for each measurement.
+//
+#ifndef BYTES_PER_RUN
+  #define BYTES_PER_RUN 4000000UL
+#endif
+
+//
+// Keeps the compiler from removing the checksum calculation.
+//
+volatile unsigned long _sink;
+
+/**
+ * @brief Hashes the buffer repeatedly and prints the cost per byte.
+ */
+template <typename TChecksum>
+void measure(const char* name, uint tableSize, byte* data, uint length)
+{
+  unsigned long runs = BYTES_PER_RUN / length;
+  unsigned long start = micros();
+
+  for (unsigned long i = 0; i < runs; i++)
+  {
+    data[0] = (byte)i;
+    _sink += TChecksum::get(data, length);
+  }
+
+  unsigned long elapsed = micros() - start;
+
+  printf("| %-24s | %6u | %6u | %10.3f |\n", name, tableSize, length, (elapsed * 1000.0) / ((double)runs * length));
+}
+
+/**
+ * @brief Measures every checksum policy for one payload size.
+ */
+void measureAll(byte* data, uint length)
+{
+  measure<Checksum<byte>>("XOR", 0, data, length);
+  measure<CRC8<byte, EEPROM_CRC_TABLE>>("CRC-8 (table)", 256, data, length);
+  measure<CRC8<byte, EEPROM_CRC_NIBBLE>>("CRC-8 (nibble)", 16, data, length);
+  measure<CRC8<byte, EEPROM_CRC_BITWISE>>("CRC-8 (bitwise)", 0, data, length);
+  measure<CRC16<byte, EEPROM_CRC_TABLE>>("CRC-16 (table)", 512, data, length);
+  measure<CRC16<byte, EEPROM_CRC_NIBBLE>>("CRC-16 (nibble)", 32, data, length);
+  measure<CRC16<byte, EEPROM_CRC_BITWISE>>("CRC-16 (bitwise)", 0, data, length);
+  measure<CRC32<byte, EEPROM_CRC_TABLE>>("CRC-32 (table)", 1024, data, length);
+  measure<CRC32<byte, EEPROM_CRC_NIBBLE>>("CRC-32 (nibble)", 64, data, length);
+  measure<CRC32<byte, EEPROM_CRC_BITWISE>>("CRC-32 (bitwise)", 0, data, length);
+}
+
+/**
+ * @brief Measures one XOR kernel over the simulated EEPROM.
+ */
+template <bool Wide>
+double measureKernel(uint length, byte* checksum)
+{
+  unsigned long runs = BYTES_PER_RUN / length;
+  unsigned long start = micros();
+
+  for (unsigned long i = 0; i < runs; i++)
+  {
+    byte buffer[EEPROM_CHECKSUM_CHUNK];
+    byte result = 0;
+
+    for (uint j = 0; j < length; j += EEPROM_CHECKSUM_CHUNK)
+    {
+      uint count = min(length - j, (uint)EEPROM_CHECKSUM_CHUNK);
+      memcpy(buffer, EEPROM.data() + j, count);
+      result ^= Wide ? Checksum<byte>::foldWords(buffer, count) : Checksum<byte>::foldBytes(buffer, count);
+    }
+
+    *checksum = result;
+    _sink += result;
+  }
+
+  return ((micros() - start) * 1000.0) / ((double)runs * length);
+}
+
+int main()
+{
+  byte data[512];
+
+  for (uint i = 0; i < sizeof(data); i++)
+  {
+    data[i] = (byte)random(256);
+  }
+
+  printf("| %-24s | %6s | %6s | %10s |\n", "Checksum", "Table", "Bytes", "ns/byte");
+  printf("|--------------------------|--------|--------|------------|\n");
+
+  measureAll(data, 8);
+  measureAll(data, 64);
+  measureAll(data, 512);
+
+  //
+  // Compare the XOR kernels. The EEPROM bytes are copied into
+  // the chunk buffer without the access counters so that only
+  // the fold is measured.
+  //
+  bool identical = true;
+
+  for (uint i = 0; i < 512; i++)
+  {
+    EEPROM.data()[i] = data[i];
+  }
+
+  printf("\n");
+  printf("| %6s | %14s | %14s | %8s |\n", "Bytes", "Byte ns/byte", "Word ns/byte", "Speedup");
+  printf("|--------|----------------|----------------|----------|\n");
+
+  for (uint length = 8; length <= 512; length *= 4)
+  {
+    byte byteChecksum = 0;
+    byte wordChecksum = 0;
+    double byteTime = measureKernel<false>(length, &byteChecksum);
+    double wordTime = measureKernel<true>(length, &wordChecksum);
+    identical = identical && (byteChecksum == wordChecksum);
+
+    printf("| %6u | %14.3f | %14.3f | %7.2fx |\n", length, byteTime, wordTime, byteTime / wordTime);
+  }
+
+  if (!identical)
+  {
+    printf("The word kernel does not match the byte kernel.\n");
+    return 1;
+  }
+
+  return 0;
+}
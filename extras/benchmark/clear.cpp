@@ -0,0 +1,122 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+
+// ---------------------------------------------------------------------------------------
+// Measures EEPROMUtil.clearEEPROM() on the simulated internal EEPROM and on a
+// simulated 24LC256 with different amounts of data to clear. The previous clear (one
+// unconditional write per byte, as made on ESP8266) is measured for comparison. The
+// estimated time uses 3.4 ms per internal EEPROM write (AVR) and the simulated bus
+// and write cycle time of the 24LC256.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-Device.h>
+
+//
+// The time of one internal EEPROM write in microseconds.
+//
+#define WRITE_MICROS 3400
+
+/**
+ * @brief Fills the given percentage of bytes with random data.
+ */
+void fill(byte* data, uint length, uint percent)
+{
+  memset(data, UNSET_VALUE, length);
+
+  for (uint i = 0; i < (length * percent) / 100; i++)
+  {
+    data[i] = (byte)random(255);
+  }
+}
+
+/**
+ * @brief The previous implementation on ESP8266.
+ */
+void clearUnconditionally()
+{
+  for (uint i = 0; i < EEPROM.length(); i++)
+  {
+    EEPROM.write(i, UNSET_VALUE);
+  }
+}
+
+/**
+ * @brief Clears the internal EEPROM and prints the traffic.
+ */
+template <typename TClear>
+void measureInternal(const char* name, uint percent, TClear clear)
+{
+  fill(EEPROM.data(), EEPROM.length(), percent);
+  EEPROM.resetCounters();
+
+  unsigned long start = micros();
+  clear();
+  unsigned long elapsed = micros() - start;
+
+  printf("| %-28s | %4u%% | %8u | %8u | %12.1f | %10lu |\n", name, percent, EEPROM.totalReads(), EEPROM.totalWrites(),
+         (EEPROM.totalWrites() * (double)WRITE_MICROS) / 1000.0, elapsed);
+}
+
+/**
+ * @brief Clears a simulated 24LC256 and prints the traffic.
+ */
+template <typename TDevice>
+void measureDevice(const char* name, uint percent, uint start, uint end)
+{
+  static TDevice device;
+  fill(device.data(), device.length(), percent);
+  EEPROMUtil.setDevice(&device);
+  device.resetCounters();
+
+  unsigned long begin = micros();
+  EEPROMUtil.clearEEPROM(UNSET_VALUE, start, end);
+  unsigned long elapsed = micros() - begin;
+
+  printf("| %-28s | %4u%% | %8u | %8u | %12.1f | %10lu |\n", name, percent, device.readTransfers(), device.pageWrites(),
+         device.elapsed() / 1000.0, elapsed);
+
+  EEPROMUtil.setDevice(nullptr);
+}
+
+int main()
+{
+  printf("| %-28s | %5s | %8s | %8s | %12s | %10s |\n", "Clear", "Used", "Reads", "Writes", "Est. ms", "Host us");
+  printf("|------------------------------|-------|----------|----------|--------------|------------|\n");
+
+  uint percents[] = { 0, 10, 100 };
+
+  for (uint percent : percents)
+  {
+    measureInternal("Internal, unconditional", percent, []() { clearUnconditionally(); });
+    measureInternal("Internal, clearEEPROM()", percent, []() { EEPROMUtil.clearEEPROM(); });
+    measureInternal("Internal, first 512 bytes", percent, []() { EEPROMUtil.clearEEPROM(UNSET_VALUE, 0, 512); });
+  }
+
+  for (uint percent : percents)
+  {
+    measureDevice<EEPROMHost24LC<32768, 1>>("24LC256, byte writes", percent, 0, 32768);
+    measureDevice<EEPROMHost24LC<32768, 64>>("24LC256, page writes", percent, 0, 32768);
+    measureDevice<EEPROMHost24LC<32768, 64>>("24LC256, first 4096 bytes", percent, 0, 4096);
+  }
+
+  return 0;
+}
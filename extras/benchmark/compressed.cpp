@@ -0,0 +1,173 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+// ---------------------------------------------------------------------------------------
+// Compares storing the Matrix struct from the structure examples and synthetic
+// sparse tables with EEPROMStorage and EEPROMCompressed. Shows the encoded size
+// and ratio, the EEPROM bytes read by get() and the bytes written by 100
+// updates that each change one field.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-Compressed.h>
+#include "../../examples/Storage/advanced-structure/struct.h"
+
+#define UPDATES 100
+
+//
+// 64 readings of which only a few are set.
+//
+struct SparseTable
+{
+  uint16_t readings[64];
+};
+
+//
+// Settings made of small integers.
+//
+struct Settings
+{
+  uint32_t ids[16];
+  int16_t offsets[16];
+  uint8_t flags[32];
+};
+
+//
+// Random bytes, the worst case.
+//
+struct Noise
+{
+  byte data[64];
+};
+
+void print(const char* name, uint size, uint reserved, uint stored, uint32_t reads, uint32_t writes)
+{
+  printf("| %-36s | %6u | %8u | %6u | %5.2f | %11lu | %13lu |\n", name, size, reserved, stored, (float)size / stored,
+    (unsigned long)reads, (unsigned long)writes);
+}
+
+template <typename T>
+void compare(const char* name, T value, void (*update)(T&, uint))
+{
+  char label[48];
+
+  //
+  // EEPROMStorage.
+  //
+  EEPROMUtil.clearEEPROM();
+  EEPROMStorage<T> storage(0, value);
+  storage = value;
+  EEPROM.resetCounters();
+  T copy = storage;
+  uint32_t reads = EEPROM.totalReads();
+  EEPROM.resetCounters();
+
+  for (uint i = 0; i < UPDATES; i++)
+  {
+    update(value, i);
+    storage = value;
+  }
+
+  snprintf(label, sizeof(label), "%s (Storage)", name);
+  print(label, sizeof(T), storage.length(), storage.length(), reads, EEPROM.totalWrites());
+
+  //
+  // EEPROMCompressed.
+  //
+  update(value, 0);
+  EEPROMUtil.clearEEPROM();
+  EEPROMCompressed<T> compressed(0, value);
+  compressed = value;
+  EEPROM.resetCounters();
+  copy = compressed;
+  reads = EEPROM.totalReads();
+  EEPROM.resetCounters();
+
+  for (uint i = 0; i < UPDATES; i++)
+  {
+    update(value, i);
+    compressed = value;
+  }
+
+  snprintf(label, sizeof(label), "%s (Compressed)", name);
+  print(label, sizeof(T), compressed.length(), compressed.HEADER_LENGTH + compressed.compressedLength(), reads, EEPROM.totalWrites());
+  (void)copy;
+}
+
+void updateMatrix(Matrix& m, uint i)
+{
+  m.sb = i % 50;
+}
+
+void updateSparse(SparseTable& t, uint i)
+{
+  t.readings[(i % 4) * 16] = 100 + i;
+}
+
+void updateSettings(Settings& s, uint i)
+{
+  s.offsets[i % 16] = (int16_t)(i % 7) - 3;
+}
+
+void updateNoise(Noise& n, uint i)
+{
+  n.data[i % sizeof(n.data)] = (byte)random(1, 256);
+}
+
+int main()
+{
+  printf("| %-36s | %6s | %8s | %6s | %5s | %11s | %13s |\n", "Value", "sizeof", "Reserved", "Stored", "Ratio", "get() reads", "Bytes written");
+  printf("|--------------------------------------|--------|----------|--------|-------|-------------|---------------|\n");
+
+  Matrix matrix;
+  memset(&matrix, 0, sizeof(matrix));
+  matrix.sa = 1;
+  matrix.sb = 2;
+  matrix.sc = 3;
+  matrix.sd = 'A';
+  matrix.se = 1.5;
+  matrix.sf = 2.5;
+  compare("Matrix (struct.h)", matrix, updateMatrix);
+
+  SparseTable sparse;
+  memset(&sparse, 0, sizeof(sparse));
+  compare("Sparse table", sparse, updateSparse);
+
+  Settings settings;
+  memset(&settings, 0, sizeof(settings));
+
+  for (uint i = 0; i < 16; i++)
+  {
+    settings.ids[i] = 1000 + i;
+    settings.flags[i] = i % 3;
+  }
+
+  compare("Small integer settings", settings, updateSettings);
+
+  Noise noise;
+
+  for (uint i = 0; i < sizeof(noise.data); i++)
+  {
+    noise.data[i] = (byte)random(1, 256);
+  }
+
+  compare("Random bytes", noise, updateNoise);
+  return 0;
+}
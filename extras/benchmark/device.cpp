@@ -0,0 +1,102 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+
+// ---------------------------------------------------------------------------------------
+// Measures the write cycles and the simulated time of common operations on a 128 byte
+// structure stored in a simulated 24LC256 (64 byte pages, 5 ms write cycle). The same
+// operations are measured with writes of one byte per cycle, as the library made them
+// before page writes were supported, and with page writes.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-Cache.h>
+#include <EEPROM-Device.h>
+
+//
+// A 128 byte structure.
+//
+struct Block
+{
+  byte data[128];
+};
+
+//
+// The address used for all variables (page aligned).
+//
+#define ADDRESS 256
+
+/**
+ * @brief Runs the operation and prints the write cycles and simulated time.
+ */
+template <typename TDevice, typename TOperation>
+void measure(const char* name, const char* operation, TDevice& device, TOperation run)
+{
+  device.resetCounters();
+  run();
+  printf("| %-12s | %-24s | %8u | %10.1f |\n", name, operation, device.pageWrites(), device.elapsed() / 1000.0);
+}
+
+/**
+ * @brief Measures every operation on the given device.
+ */
+template <typename TDevice>
+void measureDevice(const char* name)
+{
+  static TDevice device;
+  EEPROMUtil.setDevice(&device);
+
+  Block block;
+
+  for (uint i = 0; i < sizeof(block.data); i++)
+  {
+    block.data[i] = (byte)random(256);
+  }
+
+  EEPROMStorage<Block> storage(ADDRESS);
+  EEPROMCache<Block> cache(ADDRESS);
+
+  measure(name, "set() new value", device, [&]() { storage = block; });
+  measure(name, "set() same value", device, [&]() { storage = block; });
+  measure(name, "get()", device, [&]() { storage.get(); });
+
+  block.data[10]++;
+  block.data[11]++;
+  cache = block;
+  measure(name, "commit() two bytes", device, [&]() { cache.commit(); });
+
+  measure(name, "unset()", device, [&]() { storage.unset(); });
+
+  EEPROMStorage<Block>(0) = block;
+  measure(name, "clearEEPROM()", device, [&]() { EEPROMUtil.clearEEPROM(); });
+
+  EEPROMUtil.setDevice(nullptr);
+}
+
+int main()
+{
+  printf("| %-12s | %-24s | %8s | %10s |\n", "Writes", "Operation", "Cycles", "Time (ms)");
+  printf("|--------------|--------------------------|----------|------------|\n");
+
+  measureDevice<EEPROMHost24LC<32768, 1>>("Byte");
+  measureDevice<EEPROMHost24LC<32768, 64>>("Page (64)");
+
+  return 0;
+}
@@ -0,0 +1,96 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+
+// ---------------------------------------------------------------------------------------
+// Measures reading and changing one member of a 256 byte structure with get() and
+// set() compared to getField() and setField(). The variable is added to
+// EEPROMRegistry so that getField() does not validate the whole structure each time.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#define EEPROM_USE_REGISTRY true
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-Registry.h>
+
+#define ROUNDS 1000
+
+//
+// A 256 byte configuration.
+//
+struct Config
+{
+  uint16_t interval;
+  uint16_t threshold;
+  char name[32];
+  byte data[220];
+};
+
+EEPROMStorage<Config> config(0, Config());
+
+/**
+ * @brief Runs an operation ROUNDS times and prints the EEPROM accesses per round.
+ */
+template <typename TOperation>
+void measure(const char* name, TOperation operation)
+{
+  EEPROM.resetCounters();
+  unsigned long start = micros();
+
+  for (uint i = 0; i < ROUNDS; i++)
+  {
+    operation(i);
+  }
+
+  unsigned long elapsed = micros() - start;
+
+  printf("| %-30s | %8.1f | %8.1f | %10.2f |\n", name, EEPROM.totalReads() / (double)ROUNDS, EEPROM.totalWrites() / (double)ROUNDS,
+         elapsed / (double)ROUNDS);
+}
+
+int main()
+{
+  Config initial;
+  memset(&initial, 0, sizeof(initial));
+  config = initial;
+
+  EEPROMRegistry.add(config);
+  EEPROMRegistry.scan();
+
+  printf("| %-30s | %8s | %8s | %10s |\n", "One member of 256 bytes", "Reads", "Writes", "Host us");
+  printf("|--------------------------------|----------|----------|------------|\n");
+
+  uint32_t total = 0;
+
+  measure("get().interval", [&](uint) { total += config.get().interval; });
+  measure("getField(&Config::interval)", [&](uint) { total += config.getField(&Config::interval); });
+
+  measure("set() with a new interval", [&](uint i)
+  {
+    Config value = config.get();
+    value.interval = (uint16_t)i;
+    config = value;
+  });
+
+  measure("setField(&Config::interval)", [&](uint i) { config.setField(&Config::interval, (uint16_t)(i + 1)); });
+
+  printf("\n%u %d\n", total, config.isInitialized());
+  return 0;
+}
@@ -0,0 +1,148 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+// ---------------------------------------------------------------------------------------
+// Measures the checksum work done by write() when one byte of a 256 byte structure
+// changes. A full checksum reads every byte of the value; TChecksum::replace() only
+// uses the changed byte (and, for a CRC, one step per byte after it). The second
+// table writes the structure with EEPROMStorage<T>, which computes the whole
+// checksum, and commits it with EEPROMCache<T>, which updates the checksum it wrote.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-Cache.h>
+#include <EEPROM-CRC.h>
+
+#define ROUNDS 100000
+#define WRITES 1000
+
+//
+// A 256 byte structure.
+//
+struct Block
+{
+  byte data[256];
+};
+
+volatile unsigned long sink = 0;
+
+/**
+ * @brief Times a full checksum and the update of one changed byte at an offset.
+ */
+template <typename TChecksum>
+void measureChecksum(const char* name, uint offset)
+{
+  Block block;
+  memset(&block, 0x5A, sizeof(block));
+  byte oldByte = block.data[offset];
+
+  unsigned long start = micros();
+
+  for (uint i = 0; i < ROUNDS; i++)
+  {
+    block.data[offset] = (byte)i;
+    sink += TChecksum::get(block);
+  }
+
+  double full = (micros() - start) * 1000.0 / ROUNDS;
+  typename TChecksum::checksum_t checksum = TChecksum::get(block);
+  start = micros();
+
+  for (uint i = 0; i < ROUNDS; i++)
+  {
+    byte newByte = (byte)(i + 1);
+    TChecksum::replace(checksum, offset, &oldByte, &newByte, 1);
+    oldByte = newByte;
+    sink += checksum;
+  }
+
+  double incremental = (micros() - start) * 1000.0 / ROUNDS;
+  printf("| %-8s | %6u | %10.1f | %12.1f |\n", name, offset, full, incremental);
+}
+
+//
+// An EEPROMStorage<T> is written by the assignment, an EEPROMCache<T> by commit().
+//
+template <typename TChecksum>
+void commit(EEPROMStorage<Block, TChecksum>&)
+{
+}
+
+template <typename TChecksum>
+void commit(EEPROMCache<Block, TChecksum>& item)
+{
+  item.commit();
+}
+
+/**
+ * @brief Writes one changed byte WRITES times and prints the EEPROM accesses and time per write.
+ */
+template <typename TVariable>
+void measureWrite(const char* name, const char* variable)
+{
+  Block block;
+  memset(&block, 0, sizeof(block));
+
+  TVariable item(0, block);
+  item = block;
+  commit(item);
+
+  EEPROM.resetCounters();
+  unsigned long start = micros();
+
+  for (uint i = 0; i < WRITES; i++)
+  {
+    block.data[i % sizeof(block.data)]++;
+    item = block;
+    commit(item);
+  }
+
+  unsigned long elapsed = micros() - start;
+
+  printf("| %-8s | %-14s | %8.1f | %8.1f | %10.2f |\n", name, variable, EEPROM.totalReads() / (double)WRITES,
+         EEPROM.totalWrites() / (double)WRITES, elapsed / (double)WRITES);
+}
+
+int main()
+{
+  printf("| %-8s | %6s | %10s | %12s |\n", "Checksum", "Offset", "Full ns", "Replace ns");
+  printf("|----------|--------|------------|--------------|\n");
+
+  measureChecksum<Checksum<Block>>("XOR", 0);
+  measureChecksum<Checksum<Block>>("XOR", 255);
+  measureChecksum<CRC16<Block>>("CRC-16", 0);
+  measureChecksum<CRC16<Block>>("CRC-16", 128);
+  measureChecksum<CRC16<Block>>("CRC-16", 255);
+  measureChecksum<CRC32<Block>>("CRC-32", 0);
+  measureChecksum<CRC32<Block>>("CRC-32", 255);
+
+  printf("\n| %-8s | %-14s | %8s | %8s | %10s |\n", "Checksum", "Variable", "Reads", "Writes", "Host us");
+  printf("|----------|----------------|----------|----------|------------|\n");
+
+  measureWrite<EEPROMStorage<Block, Checksum<Block>>>("XOR", "EEPROMStorage");
+  measureWrite<EEPROMCache<Block, Checksum<Block>>>("XOR", "EEPROMCache");
+  measureWrite<EEPROMStorage<Block, CRC16<Block>>>("CRC-16", "EEPROMStorage");
+  measureWrite<EEPROMCache<Block, CRC16<Block>>>("CRC-16", "EEPROMCache");
+  measureWrite<EEPROMStorage<Block, CRC32<Block>>>("CRC-32", "EEPROMStorage");
+  measureWrite<EEPROMCache<Block, CRC32<Block>>>("CRC-32", "EEPROMCache");
+
+  printf("\n%lu\n", sink);
+  return 0;
+}
@@ -0,0 +1,128 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+// ---------------------------------------------------------------------------------------
+// Compares 300 optional uint16_t parameters, 40 of which are set, stored at fixed
+// addresses with EEPROMStorage and in an EEPROMKeyValue with different filter sizes.
+// Shows the EEPROM bytes used, the reads at startup and the average reads to look
+// up a parameter that is set (hit) and one that is not (miss).
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-KeyValue.h>
+
+#define PARAMETERS 300
+#define SET 40
+
+//
+// The parameter ids are spread like the ids of a real configuration.
+//
+uint16_t id(uint i)
+{
+  return (uint16_t)(1000 + (i * 7));
+}
+
+void print(const char* name, uint bytes, uint32_t bootReads, double hitReads, double missReads)
+{
+  printf("| %-40s | %6u | %10lu | %9.2f | %10.2f |\n", name, bytes, (unsigned long)bootReads, hitReads, missReads);
+}
+
+template <uint FilterBits>
+void measure(const char* name)
+{
+  EEPROMUtil.clearEEPROM();
+
+  {
+    EEPROMKeyValue<64, 2, uint16_t, FilterBits> table(0);
+
+    for (uint i = 0; i < SET; i++)
+    {
+      table.put(id(i * (PARAMETERS / SET)), (uint16_t)i);
+    }
+  }
+
+  EEPROM.resetCounters();
+  EEPROMKeyValue<64, 2, uint16_t, FilterBits> table(0);
+  table.rebuild();
+  uint32_t bootReads = EEPROM.totalReads();
+  uint32_t hitReads = 0;
+  uint32_t missReads = 0;
+
+  for (uint i = 0; i < PARAMETERS; i++)
+  {
+    EEPROM.resetCounters();
+    uint16_t value = table.get(id(i), (uint16_t)0);
+    (void)value;
+
+    if (i % (PARAMETERS / SET) == 0)
+    {
+      hitReads += EEPROM.totalReads();
+    }
+    else
+    {
+      missReads += EEPROM.totalReads();
+    }
+  }
+
+  print(name, table.length(), bootReads, (double)hitReads / SET, (double)missReads / (PARAMETERS - SET));
+}
+
+int main()
+{
+  printf("| %-40s | %6s | %10s | %9s | %10s |\n", "300 parameters, 40 set", "Bytes", "Boot reads", "Hit reads", "Miss reads");
+  printf("|------------------------------------------|--------|------------|-----------|------------|\n");
+
+  //
+  // One EEPROMStorage variable per parameter.
+  //
+  EEPROMUtil.clearEEPROM();
+
+  for (uint i = 0; i < SET; i++)
+  {
+    EEPROMStorage<uint16_t>(i * (PARAMETERS / SET) * 3) = i;
+  }
+
+  uint32_t hitReads = 0;
+  uint32_t missReads = 0;
+
+  for (uint i = 0; i < PARAMETERS; i++)
+  {
+    EEPROM.resetCounters();
+    uint16_t value = EEPROMStorage<uint16_t>(i * 3, 0);
+    (void)value;
+
+    if (i % (PARAMETERS / SET) == 0)
+    {
+      hitReads += EEPROM.totalReads();
+    }
+    else
+    {
+      missReads += EEPROM.totalReads();
+    }
+  }
+
+  print("EEPROMStorage at fixed addresses", PARAMETERS * 3, 0, (double)hitReads / SET, (double)missReads / (PARAMETERS - SET));
+
+  measure<64>("EEPROMKeyValue<64, 2>, 64 bit filter");
+  measure<256>("EEPROMKeyValue<64, 2>, 256 bit filter");
+  measure<1024>("EEPROMKeyValue<64, 2>, 1024 bit filter");
+
+  return 0;
+}
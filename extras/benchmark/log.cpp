@@ -0,0 +1,111 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+// ---------------------------------------------------------------------------------------
+// Compares recording 10000 events of 8 bytes in a ring of 64 records with an
+// EEPROMStorage index variable and manual address math to an EEPROMLog. The most
+// written EEPROM cell shows the wear; the reads at startup show the cost of finding
+// the newest record.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-Log.h>
+
+#define EVENTS 10000
+#define RECORDS 64
+
+//
+// An 8 byte event.
+//
+struct Event
+{
+  uint32_t time;
+  int16_t value;
+  uint16_t code;
+};
+
+void print(const char* name, uint32_t maxWrites, uint32_t bootReads)
+{
+  printf("| %-36s | %14lu | %10lu |\n", name, (unsigned long)maxWrites, (unsigned long)bootReads);
+}
+
+int main()
+{
+  printf("| %-36s | %14s | %10s |\n", "10000 events, 64 records", "Max cell writes", "Boot reads");
+  printf("|--------------------------------------|-----------------|------------|\n");
+
+  //
+  // An index variable followed by the records.
+  //
+  EEPROMUtil.clearEEPROM();
+  EEPROMStorage<uint16_t> index(0, 0);
+  EEPROMStorage<Event> first(index.nextAddress());
+  EEPROM.resetCounters();
+
+  for (uint i = 0; i < EVENTS; i++)
+  {
+    Event event = { i, (int16_t)(i % 100), (uint16_t)i };
+    uint16_t next = (index + 1) % RECORDS;
+    EEPROMStorage<Event>(first.getAddress() + next * first.length()) = event;
+    index = next;
+  }
+
+  uint32_t maxWrites = EEPROM.maxWriteCount();
+  EEPROM.resetCounters();
+  uint16_t newest = index;
+  (void)newest;
+  print("EEPROMStorage index + records", maxWrites, EEPROM.totalReads());
+
+  //
+  // The log.
+  //
+  EEPROMUtil.clearEEPROM();
+  EEPROMLog<Event, RECORDS> log(0);
+  EEPROM.resetCounters();
+
+  for (uint i = 0; i < EVENTS; i++)
+  {
+    Event event = { i, (int16_t)(i % 100), (uint16_t)i };
+    log.append(event);
+  }
+
+  maxWrites = EEPROM.maxWriteCount();
+  EEPROM.resetCounters();
+  EEPROMLog<Event, RECORDS> restarted(0);
+  restarted.recover();
+  print("EEPROMLog<Event, 64>", maxWrites, EEPROM.totalReads());
+
+  //
+  // A linear scan that validates every slot for comparison.
+  //
+  EEPROM.resetCounters();
+  byte slot[EEPROMLog<Event, RECORDS>::SLOT_LENGTH];
+
+  for (uint i = 0; i < RECORDS; i++)
+  {
+    EEPROMUtil.readBlock(i * sizeof(slot), slot, sizeof(slot));
+  }
+
+  print("Linear scan of every slot", 0, EEPROM.totalReads());
+
+  Event event;
+  printf("\n%u %d\n", restarted.count(), restarted.newest(event) && event.time == EVENTS - 1);
+  return 0;
+}
@@ -0,0 +1,142 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+// ---------------------------------------------------------------------------------------
+// Upgrades the Matrix struct from the structure examples to a version with a new
+// field and compares the EEPROM bytes written by writing the defaults again, by
+// reading the old struct and writing the converted struct, and by an EEPROMSchema
+// migration. The time assumes 3.3 ms per byte written, as on the AVR EEPROM.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#include <stddef.h>
+#include <EEPROM-Storage.h>
+#include <EEPROM-Migration.h>
+#include "../../examples/Storage/advanced-structure/struct.h"
+
+//
+// Version 2 of Matrix adds sg after sc.
+//
+struct MatrixV2
+{
+  uint8_t sa;
+  uint16_t sb;
+  uint32_t sc;
+  uint32_t sg;
+  char sd;
+  float se;
+  double sf;
+  char _buffer[11];
+};
+
+#define SCHEMA 0
+#define ADDRESS (SCHEMA + EEPROMSchema<>::LENGTH)
+
+void print(const char* name, uint32_t writes, const char* resumable)
+{
+  printf("| %-36s | %13lu | %9.1f | %-9s |\n", name, (unsigned long)writes, writes * 3.3, resumable);
+}
+
+Matrix original()
+{
+  Matrix m;
+  memset(&m, 0, sizeof(m));
+  m.sa = 1;
+  m.sb = 2;
+  m.sc = 3;
+  m.sd = 'A';
+  m.se = 1.5;
+  m.sf = 2.5;
+  return m;
+}
+
+void store()
+{
+  EEPROMUtil.clearEEPROM();
+  EEPROMStorage<Matrix> item(ADDRESS);
+  item = original();
+  EEPROM.resetCounters();
+}
+
+int main()
+{
+  printf("| %-36s | %13s | %9s | %-9s |\n", "Matrix to MatrixV2", "Bytes written", "Time (ms)", "Resumable");
+  printf("|--------------------------------------|---------------|-----------|-----------|\n");
+
+  //
+  // Writing the defaults loses the stored values.
+  //
+  store();
+  MatrixV2 defaults;
+  memset(&defaults, 0, sizeof(defaults));
+  EEPROMStorage<MatrixV2> reprovisioned(ADDRESS);
+  reprovisioned = defaults;
+  print("Write the defaults", EEPROM.totalWrites(), "-");
+
+  //
+  // Read the old struct and write the new one.
+  //
+  store();
+  Matrix m = EEPROMStorage<Matrix>(ADDRESS, original());
+  MatrixV2 converted;
+  memset(&converted, 0, sizeof(converted));
+  converted.sa = m.sa;
+  converted.sb = m.sb;
+  converted.sc = m.sc;
+  converted.sd = m.sd;
+  converted.se = m.se;
+  converted.sf = m.sf;
+  memcpy(converted._buffer, m._buffer, sizeof(m._buffer));
+  EEPROMStorage<MatrixV2> rewritten(ADDRESS);
+  rewritten = converted;
+  print("Read, convert and write", EEPROM.totalWrites(), "no");
+
+  //
+  // Migrate the fields after the new one, last field first.
+  //
+  uint32_t sg = 0;
+
+  EEPROMMigration operations[] =
+  {
+    eepromMove(ADDRESS + offsetof(Matrix, _buffer), ADDRESS + offsetof(MatrixV2, _buffer), sizeof(Matrix::_buffer)),
+    eepromMove(ADDRESS + offsetof(Matrix, sf), ADDRESS + offsetof(MatrixV2, sf), sizeof(double)),
+    eepromMove(ADDRESS + offsetof(Matrix, se), ADDRESS + offsetof(MatrixV2, se), sizeof(float)),
+    eepromMove(ADDRESS + offsetof(Matrix, sd), ADDRESS + offsetof(MatrixV2, sd), sizeof(char)),
+    eepromSet(ADDRESS + offsetof(MatrixV2, sg), &sg, sizeof(sg)),
+    eepromChecksum(ADDRESS, sizeof(Matrix), ADDRESS, sizeof(MatrixV2))
+  };
+
+  EEPROMMigrationStep steps[] = { { 2, operations, sizeof(operations) / sizeof(operations[0]) } };
+
+  store();
+  EEPROMSchema<> schema(SCHEMA, 1);
+  schema.migrate(steps, 1);
+  print("EEPROMSchema migration", EEPROM.totalWrites(), "yes");
+
+  EEPROM.resetCounters();
+  EEPROMSchema<> rebooted(SCHEMA, 1);
+  rebooted.migrate(steps, 1);
+  print("EEPROMSchema at the newest version", EEPROM.totalWrites(), "-");
+
+  MatrixV2 value;
+  bool valid = EEPROMStorage<MatrixV2>(ADDRESS, defaults).read(value);
+  printf("\n%d %d\n", valid, value.sa == converted.sa && value.sb == converted.sb && value.sc == converted.sc &&
+         value.sg == 0 && value.sd == converted.sd && value.se == converted.se && value.sf == converted.sf);
+  return 0;
+}
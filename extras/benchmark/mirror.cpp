@@ -0,0 +1,100 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+
+// ---------------------------------------------------------------------------------------
+// Measures EEPROMMirror on a simulated 24LC32. Sixteen counters are incremented 100
+// times each, as a sketch would from loop(), first directly on the device and then
+// through a mirror that syncs after every 10 rounds (standing in for the deadline).
+// The estimated time uses the simulated bus and write cycle time of the 24LC32.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-Device.h>
+#include <EEPROM-Mirror.h>
+
+#define COUNTERS 16
+#define ROUNDS 100
+#define SYNC_ROUNDS 10
+
+typedef EEPROMHost24LC<4096, 32> Device;
+
+/**
+ * @brief Increments every counter ROUNDS times and prints the traffic.
+ * @param mirror The mirror to sync, or nullptr to write directly to the device.
+ */
+void measure(const char* name, Device& device, EEPROMMirror<4096>* mirror)
+{
+  EEPROMStorage<uint32_t>* counters[COUNTERS];
+  uint address = 0;
+
+  for (uint i = 0; i < COUNTERS; i++)
+  {
+    counters[i] = new EEPROMStorage<uint32_t>(address, 0);
+    address = counters[i]->nextAddress();
+  }
+
+  device.resetCounters();
+  unsigned long start = micros();
+
+  for (uint round = 1; round <= ROUNDS; round++)
+  {
+    for (uint i = 0; i < COUNTERS; i++)
+    {
+      (*counters[i])++;
+    }
+
+    if (mirror && round % SYNC_ROUNDS == 0)
+    {
+      mirror->sync();
+    }
+  }
+
+  unsigned long elapsed = micros() - start;
+
+  printf("| %-24s | %8u | %8u | %12.1f | %10lu |\n", name, device.readTransfers(), device.pageWrites(),
+         device.elapsed() / 1000.0, elapsed);
+
+  for (uint i = 0; i < COUNTERS; i++)
+  {
+    delete counters[i];
+  }
+}
+
+int main()
+{
+  printf("| %-24s | %8s | %8s | %12s | %10s |\n", "Counters", "Reads", "Writes", "Est. ms", "Host us");
+  printf("|--------------------------|----------|----------|--------------|------------|\n");
+
+  static Device direct;
+  EEPROMUtil.setDevice(&direct);
+  measure("24LC32, direct", direct, nullptr);
+
+  static Device backing;
+  static EEPROMMirror<4096> mirror(&backing);
+  mirror.setDeadline(0);
+  mirror.setBudget(0);
+  mirror.begin();
+  measure("24LC32, mirror", backing, &mirror);
+  mirror.end();
+
+  EEPROMUtil.setDevice(nullptr);
+  return 0;
+}
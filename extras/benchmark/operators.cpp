@@ -0,0 +1,98 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+
+// ---------------------------------------------------------------------------------------
+// Measures the size of the variable classes, with the address and default value held
+// in RAM and at compile time (EEPROMStaticStorage and EEPROMStaticCache), and the time of the compound assignment
+// operators of EEPROMCache<T>, which only change the cached value. The operators call
+// get() and set() of the derived class without a virtual call.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-Cache.h>
+#include <EEPROM-WearLeveled.h>
+
+#define OPERATIONS 10000000UL
+
+//
+// A 64 byte structure.
+//
+struct Record
+{
+  byte data[64];
+};
+
+/**
+ * @brief Prints the size of a variable class.
+ */
+template <typename TVariable>
+void size(const char* name)
+{
+  printf("| %-32s | %6u |\n", name, (uint)sizeof(TVariable));
+}
+
+/**
+ * @brief Applies an operator OPERATIONS times and prints the time per operation.
+ */
+template <typename TOperation>
+void measure(const char* name, TOperation operation)
+{
+  unsigned long start = micros();
+
+  for (unsigned long i = 0; i < OPERATIONS; i++)
+  {
+    operation(i);
+  }
+
+  unsigned long elapsed = micros() - start;
+  printf("| %-32s | %10.2f |\n", name, (elapsed * 1000.0) / OPERATIONS);
+}
+
+int main()
+{
+  printf("| %-32s | %6s |\n", "Class", "Bytes");
+  printf("|----------------------------------|--------|\n");
+  size<EEPROMStorage<uint32_t>>("EEPROMStorage<uint32_t>");
+  size<EEPROMCache<int>>("EEPROMCache<int>");
+  size<EEPROMCache<uint8_t>>("EEPROMCache<uint8_t>");
+  size<EEPROMWearLeveled<uint32_t, 4>>("EEPROMWearLeveled<uint32_t, 4>");
+  size<EEPROMStaticStorage<uint32_t, 0>>("EEPROMStaticStorage<uint32_t, 0>");
+  size<EEPROMStaticCache<int, 0>>("EEPROMStaticCache<int, 0>");
+  size<EEPROMStorage<Record>>("EEPROMStorage<Record>");
+  size<EEPROMStaticStorage<Record, 0>>("EEPROMStaticStorage<Record, 0>");
+  size<EEPROMCache<Record>>("EEPROMCache<Record>");
+  size<EEPROMStaticCache<Record, 0>>("EEPROMStaticCache<Record, 0>");
+
+  EEPROMCache<int> x(0, 0);
+  EEPROMCache<uint32_t> y(x.nextAddress(), 0);
+
+  printf("\n| %-32s | %10s |\n", "EEPROMCache operator", "ns per op");
+  printf("|----------------------------------|------------|\n");
+  measure("x += 1 (int)", [&](unsigned long) { x += 1; });
+  measure("x++ (int)", [&](unsigned long) { x++; });
+  measure("y ^= i (uint32_t)", [&](unsigned long i) { y ^= (uint32_t)i; });
+
+  //
+  // Keep the results so the loops are not removed.
+  //
+  printf("\n%d %u\n", (int)x, (uint32_t)y);
+  return 0;
+}
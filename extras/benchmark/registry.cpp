@@ -0,0 +1,152 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+
+// ---------------------------------------------------------------------------------------
+// Measures the startup check of EEPROM_REGISTRY_SIZE variables of mixed types packed
+// into a 4 KB EEPROM: calling isInitialized() on every variable compared to a single
+// EEPROMRegistry.scan() followed by the same calls, which then use the cached results.
+// The check is made on the simulated internal EEPROM and on a simulated 24LC32, where
+// every read is an I2C transfer.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#define EEPROM_USE_REGISTRY true
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-Registry.h>
+#include <EEPROM-Device.h>
+
+//
+// A larger record to mix in with the scalar variables.
+//
+struct Settings
+{
+  uint32_t serial;
+  float calibration[8];
+  char name[16];
+};
+
+//
+// The variables, one of each type per group.
+//
+#define GROUPS (EEPROM_REGISTRY_SIZE / 4)
+
+EEPROMStorage<uint8_t>* bytes[GROUPS];
+EEPROMStorage<uint32_t>* longs[GROUPS];
+EEPROMStorage<double>* doubles[GROUPS];
+EEPROMStorage<Settings>* records[GROUPS];
+
+/**
+ * @brief Creates the variables, sets half of them and adds them to the registry.
+ */
+void setup()
+{
+  uint address = 0;
+
+  for (uint i = 0; i < GROUPS; i++)
+  {
+    bytes[i] = new EEPROMStorage<uint8_t>(address, 0);
+    longs[i] = new EEPROMStorage<uint32_t>(bytes[i]->nextAddress(), 0);
+    doubles[i] = new EEPROMStorage<double>(longs[i]->nextAddress(), 0);
+    records[i] = new EEPROMStorage<Settings>(doubles[i]->nextAddress(), Settings());
+    address = records[i]->nextAddress();
+
+    if (i % 2 == 0)
+    {
+      *bytes[i] = (uint8_t)i;
+      *longs[i] = (uint32_t)i;
+      *doubles[i] = (double)i;
+      *records[i] = Settings();
+    }
+
+    EEPROMRegistry.add(*bytes[i]);
+    EEPROMRegistry.add(*longs[i]);
+    EEPROMRegistry.add(*doubles[i]);
+    EEPROMRegistry.add(*records[i]);
+  }
+}
+
+/**
+ * @brief Calls isInitialized() on every variable.
+ */
+uint check()
+{
+  uint returnValue = 0;
+
+  for (uint i = 0; i < GROUPS; i++)
+  {
+    returnValue += bytes[i]->isInitialized() ? 1 : 0;
+    returnValue += longs[i]->isInitialized() ? 1 : 0;
+    returnValue += doubles[i]->isInitialized() ? 1 : 0;
+    returnValue += records[i]->isInitialized() ? 1 : 0;
+  }
+
+  return returnValue;
+}
+
+/**
+ * @brief Runs the startup check and prints the traffic.
+ */
+template <typename TReads>
+void measure(const char* name, bool scan, TReads reads)
+{
+  EEPROMRegistry.invalidate();
+  EEPROM.resetCounters();
+  unsigned long start = micros();
+  uint initialized = (scan ? EEPROMRegistry.scan() : 0);
+  initialized = check();
+  unsigned long elapsed = micros() - start;
+
+  printf("| %-30s | %9u | %8u | %10lu |\n", name, initialized, reads(), elapsed);
+}
+
+int main()
+{
+  setup();
+
+  printf("%u variables, %u bytes.\n\n", EEPROMRegistry.count(), records[GROUPS - 1]->nextAddress());
+  printf("| %-30s | %9s | %8s | %10s |\n", "Startup check", "Set", "Reads", "Host us");
+  printf("|--------------------------------|-----------|----------|------------|\n");
+
+  measure("Internal, isInitialized()", false, []() { return EEPROM.totalReads(); });
+  measure("Internal, scan()", true, []() { return EEPROM.totalReads(); });
+
+  EEPROM.resetCounters();
+  uint initialized = check();
+  printf("| %-30s | %9u | %8u | %10s |\n", "Internal, after scan()", initialized, EEPROM.totalReads(), "");
+
+  //
+  // Copy the variables to a simulated 24LC32.
+  //
+  static EEPROMHost24LC<4096, 32> device;
+  memcpy(device.data(), EEPROM.data(), device.length());
+  EEPROMUtil.setDevice(&device);
+
+  device.resetCounters();
+  measure("24LC32, isInitialized()", false, []() { return device.readTransfers(); });
+  printf("|   %-28s | %9s | %8s | %10.1f |\n", "estimated bus ms", "", "", device.elapsed() / 1000.0);
+
+  device.resetCounters();
+  measure("24LC32, scan()", true, []() { return device.readTransfers(); });
+  printf("|   %-28s | %9s | %8s | %10.1f |\n", "estimated bus ms", "", "", device.elapsed() / 1000.0);
+
+  EEPROMUtil.setDevice(nullptr);
+  return 0;
+}
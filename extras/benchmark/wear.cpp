@@ -0,0 +1,116 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+
+// ---------------------------------------------------------------------------------------
+// Measures the per-cell wear of a uint32_t counter incremented INCREMENTS times when
+// stored in EEPROMStorage<T>, in EEPROMWearLeveled<T, Slots> with different numbers
+// of slots and in EEPROMCounter<T, PoolBytes> with different pool sizes. The highest write count of any single cell determines when the EEPROM
+// wears out.
+//
+// Build and run with extras/host/build.sh.
+// ---------------------------------------------------------------------------------------
+
+#include <EEPROM-Storage.h>
+#include <EEPROM-WearLeveled.h>
+#include <EEPROM-Counter.h>
+
+//
+// The number of increments of each counter.
+//
+#ifndef INCREMENTS
+  #define INCREMENTS 10000
+#endif
+
+//
+// The address used for all variables.
+//
+#define ADDRESS 100
+
+/**
+ * @brief Increments the counter and prints the EEPROM traffic.
+ */
+template <typename TVariable>
+void measure(const char* name, TVariable& counter)
+{
+  counter.unset();
+  counter = 0;
+  EEPROM.resetCounters();
+
+  for (uint i = 0; i < INCREMENTS; i++)
+  {
+    counter++;
+  }
+
+  printf("| %-32s | %6u | %12u | %12.2f | %12.2f | %12.2f |\n", name, counter.length(), EEPROM.maxWriteCount(),
+         (double)EEPROM.totalWrites() / INCREMENTS, (double)EEPROM.totalReads() / INCREMENTS,
+         (double)INCREMENTS / EEPROM.maxWriteCount());
+}
+
+int main()
+{
+  printf("| %-32s | %6s | %12s | %12s | %12s | %12s |\n", "Variable", "Bytes", "Max Writes", "Writes/inc", "Reads/inc", "Life Factor");
+  printf("|----------------------------------|--------|--------------|--------------|--------------|--------------|\n");
+
+  {
+    EEPROMStorage<uint32_t> counter(ADDRESS);
+    measure("EEPROMStorage<uint32_t>", counter);
+  }
+
+  {
+    EEPROMWearLeveled<uint32_t, 2> counter(ADDRESS);
+    measure("EEPROMWearLeveled<uint32_t, 2>", counter);
+  }
+
+  {
+    EEPROMWearLeveled<uint32_t, 4> counter(ADDRESS);
+    measure("EEPROMWearLeveled<uint32_t, 4>", counter);
+  }
+
+  {
+    EEPROMWearLeveled<uint32_t, 8> counter(ADDRESS);
+    measure("EEPROMWearLeveled<uint32_t, 8>", counter);
+  }
+
+  {
+    EEPROMWearLeveled<uint32_t, 16> counter(ADDRESS);
+    measure("EEPROMWearLeveled<uint32_t, 16>", counter);
+  }
+
+  {
+    EEPROMWearLeveled<uint32_t, 32> counter(ADDRESS);
+    measure("EEPROMWearLeveled<uint32_t, 32>", counter);
+  }
+
+  {
+    EEPROMCounter<uint32_t, 4> counter(ADDRESS);
+    measure("EEPROMCounter<uint32_t, 4>", counter);
+  }
+
+  {
+    EEPROMCounter<uint32_t, 8> counter(ADDRESS);
+    measure("EEPROMCounter<uint32_t, 8>", counter);
+  }
+
+  {
+    EEPROMCounter<uint32_t, 32> counter(ADDRESS);
+    measure("EEPROMCounter<uint32_t, 32>", counter);
+  }
+
+  return 0;
+}
@@ -0,0 +1,51 @@
+#
+# Builds the tests and benchmarks with GNU C++ against the simulated
+# EEPROM in src/EEPROM-Host.h and runs them on this computer. The
+# script exits with a non-zero code if any build or test fails.
+#
+# Usage: ./build.sh
+#
+
+# Set the C++ compiler
+CXX="${CXX:-g++}"
+
+# Set the library and output directories
+ROOT_DIR="$(cd "$(dirname "$0")/../.." && pwd)"
+BUILD_DIR="$ROOT_DIR/extras/host/build"
+TESTS_DIR="$ROOT_DIR/examples/General/tests"
+
+# Set the compiler flags. The tests apply the shift and multiply operators
+# to bool variables on purpose, so -Wint-in-bool-context is turned off.
+CXXFLAGS="-std=gnu++11 -O2 -Wall -Wextra -Wno-int-in-bool-context -I$ROOT_DIR/src -I$TESTS_DIR"
+
+mkdir -p "$BUILD_DIR" || exit 1
+
+#
+# Build and run the test sketch once for each target library.
+#
+for TARGET in TARGET_STORAGE TARGET_CACHE
+do
+    echo "Building tests ($TARGET)."
+    $CXX $CXXFLAGS -D$TARGET -x c++ "$TESTS_DIR/tests.ino" -x none \
+        "$TESTS_DIR/Assert.cpp" "$ROOT_DIR/src/EEPROM-Debug.cpp" "$ROOT_DIR/extras/host/main.cpp" \
+        -o "$BUILD_DIR/tests-$TARGET" || { echo "Compilation failed. Check for errors."; exit 1; }
+
+    echo "Running tests ($TARGET)."
+    "$BUILD_DIR/tests-$TARGET" > "$BUILD_DIR/tests-$TARGET.log" || { cat "$BUILD_DIR/tests-$TARGET.log"; echo "Tests failed ($TARGET)."; exit 1; }
+    tail -3 "$BUILD_DIR/tests-$TARGET.log"
+done
+
+#
+# Build and run each benchmark in extras/benchmark.
+#
+for SOURCE in "$ROOT_DIR"/extras/benchmark/*.cpp
+do
+    NAME="$(basename "$SOURCE" .cpp)"
+
+    echo "Building $NAME."
+    $CXX $CXXFLAGS "$SOURCE" "$ROOT_DIR/src/EEPROM-Debug.cpp" -o "$BUILD_DIR/$NAME" || { echo "Compilation failed. Check for errors."; exit 1; }
+
+    echo "Running $NAME."
+    "$BUILD_DIR/$NAME" > "$BUILD_DIR/$NAME.txt" || { echo "Benchmark failed ($NAME)."; exit 1; }
+    echo "Results saved to $BUILD_DIR/$NAME.txt"
+done
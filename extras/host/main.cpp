@@ -0,0 +1,35 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+
+// ---------------------------------------------------------------------------------------
+// Host entry point for sketches compiled with GNU C++ against EEPROM-Host.h. The
+// sketch is compiled as a separate translation unit and its setup() is run once.
+// ---------------------------------------------------------------------------------------
+
+//
+// Defined by the sketch.
+//
+void setup();
+extern int _failedTests;
+
+int main()
+{
+  setup();
+  return _failedTests == 0 ? 0 : 1;
+}
@@ -0,0 +1,189 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_24LC_H
+#define EEPROM_24LC_H
+
+/**
+ * @file EEPROM-24LC.h
+ * @brief This file contains the EEPROM24LC definition.
+ */
+
+//
+// Cross-compatable with Arduino and Particle. The host
+// uses EEPROMHost24LC in EEPROM-Device.h instead.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+  #include <Wire.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#endif
+
+#include "EEPROM-Device.h"
+
+#if (defined(ARDUINO) && ARDUINO >= 100) || defined(PARTICLE)
+
+/**
+ * @brief The number of bytes the Wire library can send or receive in one transfer.
+ */
+#ifndef EEPROM_WIRE_BUFFER
+  #if defined(BUFFER_LENGTH)
+    #define EEPROM_WIRE_BUFFER BUFFER_LENGTH
+  #elif defined(I2C_BUFFER_LENGTH)
+    #define EEPROM_WIRE_BUFFER I2C_BUFFER_LENGTH
+  #else
+    #define EEPROM_WIRE_BUFFER 32
+  #endif
+#endif
+
+/**
+ * @class EEPROM24LC
+ * @brief Microchip 24LCxx (and compatible) I2C EEPROM.
+ * @details Uses two address bytes, which covers the 24LC32 to 24LC512.
+ * Call Wire.begin() before using the device. After each page write the
+ * device is polled until it acknowledges its address, which is when the
+ * write cycle has completed.
+ *
+ * The two address bytes and the data of a write share the Wire buffer
+ * (EEPROM_WIRE_BUFFER bytes), so a page is written in chunks of
+ * EEPROM_WIRE_BUFFER - 2 bytes and each chunk takes one write cycle
+ * (about 5 ms). With the 32 byte buffer of the AVR and Particle cores a
+ * full 64 byte page takes three write cycles; with the 128 byte buffer
+ * of the ESP8266 and ESP32 cores it takes one. EEPROMUtil only writes the
+ * changed bytes of a page, so most writes fit in a single chunk.
+ *
+ *     EEPROM24LC external(0x50, 32768, 64);	// 24LC256
+ *     EEPROMUtil.setDevice(&external);
+ */
+class EEPROM24LC : public EEPROMDevice
+{
+  public:
+    static const uint WRITE_TIMEOUT = 20; ///< The maximum write cycle time in milliseconds.
+
+    /**
+     * @brief Initialize an instance of EEPROM24LC.
+     * @param i2cAddress The 7 bit I2C address (0x50 to 0x57).
+     * @param length The number of bytes in the device.
+     * @param pageSize The page size of the device.
+     */
+    EEPROM24LC(byte i2cAddress, uint length, uint pageSize) : _i2cAddress(i2cAddress), _length(length), _pageSize(pageSize)
+    {
+    }
+
+    uint length()
+    {
+      return this->_length;
+    }
+
+    uint pageSize()
+    {
+      return this->_pageSize;
+    }
+
+    byte read(uint address)
+    {
+      byte returnValue = UNSET_VALUE;
+      this->read(address, &returnValue, 1);
+      return returnValue;
+    }
+
+    void read(uint address, byte* data, uint length)
+    {
+      while (length > 0)
+      {
+        uint count = min(length, (uint)EEPROM_WIRE_BUFFER);
+
+        Wire.beginTransmission(this->_i2cAddress);
+        Wire.write((byte)(address >> 8));
+        Wire.write((byte)address);
+        Wire.endTransmission(false);
+        Wire.requestFrom(this->_i2cAddress, (byte)count);
+
+        for (uint i = 0; i < count; i++)
+        {
+          data[i] = Wire.available() ? Wire.read() : UNSET_VALUE;
+        }
+
+        address += count;
+        data += count;
+        length -= count;
+      }
+    }
+
+    bool write(uint address, const byte* data, uint length)
+    {
+      bool returnValue = true;
+
+      //
+      // The two address bytes share the Wire buffer with the data.
+      //
+      while (length > 0)
+      {
+        uint count = min(length, (uint)(EEPROM_WIRE_BUFFER - 2));
+
+        Wire.beginTransmission(this->_i2cAddress);
+        Wire.write((byte)(address >> 8));
+        Wire.write((byte)address);
+        Wire.write(data, count);
+
+        //
+        // Wait even if the transfer was not acknowledged, since the
+        // device may have started a write cycle with part of the data.
+        //
+        bool sent = (Wire.endTransmission() == 0);
+
+        if (!this->waitForWriteCycle() || !sent)
+        {
+          returnValue = false;
+        }
+
+        address += count;
+        data += count;
+        length -= count;
+      }
+
+      return returnValue;
+    }
+
+  protected:
+    byte _i2cAddress;
+    uint _length;
+    uint _pageSize;
+
+    /**
+     * @brief Polls the device until it acknowledges its address.
+     * @return False if the device did not respond within WRITE_TIMEOUT, true otherwise.
+     */
+    bool waitForWriteCycle()
+    {
+      unsigned long start = millis();
+      bool returnValue = false;
+
+      do
+      {
+        Wire.beginTransmission(this->_i2cAddress);
+        returnValue = (Wire.endTransmission() == 0);
+      } while (!returnValue && (millis() - start) < WRITE_TIMEOUT);
+
+      return returnValue;
+    }
+};
+#endif
+#endif
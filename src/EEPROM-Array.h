@@ -0,0 +1,547 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_ARRAY_H
+#define EEPROM_ARRAY_H
+
+/**
+ * @file EEPROM-Array.h
+ * @brief This file contains the EEPROMArray<T, N> definition.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+  #include <EEPROM.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+#include "EEPROM-Vars.h"
+#include "EEPROM-Util.h"
+#include "EEPROM-Checksum.h"
+#include "EEPROM-CRC.h"
+#include "EEPROM-Operators.h"
+
+/**
+ * @class EEPROMArrayElement
+ * @brief One element of an EEPROMArray returned by operator[].
+ * @details Reading the element reads its block from the array and assigning it
+ * writes the block. The increment, decrement and compound assignment operators
+ * work the same as on an EEPROMStorage variable.
+ * @tparam TArray The EEPROMArray holding the element.
+ */
+template <typename TArray>
+class EEPROMArrayElement : public EEPROMOperators<typename TArray::value_type, EEPROMArrayElement<TArray>>
+{
+  public:
+    typedef typename TArray::value_type value_type; ///< The type of the element.
+
+    /**
+     * @brief Initialize an instance of EEPROMArrayElement for an element of an array.
+     * @param array The array holding the element.
+     * @param index The index of the element.
+     */
+    EEPROMArrayElement(TArray& array, uint index) : _array(array), _index(index)
+    {
+    }
+
+    /**
+     * @brief Implicitly converts the element to its value.
+     * @return The value of the element.
+     */
+    operator value_type() const
+    {
+      return this->get();
+    }
+
+    /**
+     * @brief Assignment operator.
+     * @param value The new value of the element.
+     * @return This element.
+     */
+    EEPROMArrayElement& operator = (value_type const& value)
+    {
+      this->set(value);
+      return *this;
+    }
+
+    /**
+     * @brief Assigns the value of another element, as in array[1] = array[2].
+     * @param element The element whose value is copied.
+     * @return This element.
+     */
+    EEPROMArrayElement& operator = (EEPROMArrayElement const& element)
+    {
+      this->set(element.get());
+      return *this;
+    }
+
+    /**
+     * @brief Gets the value of the element.
+     * @return The stored value or the default value of the array.
+     */
+    value_type get() const
+    {
+      return this->_array.get(this->_index);
+    }
+
+    /**
+     * @brief Sets the value of the element.
+     * @param value The new value of the element.
+     * @return The new value.
+     */
+    value_type set(value_type const& value)
+    {
+      return this->_array.set(this->_index, value);
+    }
+
+  protected:
+    TArray& _array;
+    uint _index;
+};
+
+/**
+ * @class EEPROMArrayIterator
+ * @brief Iterates over the values of an EEPROMArray one block at a time.
+ * @details Each block is read with one block read when the first of its
+ * elements is dereferenced, so a range-based for loop reads every byte
+ * of the array once. The values are read only.
+ * @tparam TArray The EEPROMArray being iterated.
+ */
+template <typename TArray>
+class EEPROMArrayIterator
+{
+  public:
+    typedef typename TArray::value_type value_type; ///< The type of the element.
+
+    /**
+     * @brief Initialize an instance of EEPROMArrayIterator at an index.
+     * @param array The array being iterated.
+     * @param index The index of the current element.
+     */
+    EEPROMArrayIterator(const TArray& array, uint index) : _array(array), _index(index)
+    {
+    }
+
+    /**
+     * @brief Gets the value of the current element.
+     * @return The stored value or the default value of the array.
+     */
+    value_type operator * ()
+    {
+      uint block = this->_index / TArray::BLOCK;
+
+      if (block != this->_block)
+      {
+        this->_valid = this->_array.readBlock(block, this->_data);
+        this->_block = block;
+      }
+
+      value_type returnValue;
+      this->_array.getElement(this->_index, this->_data, this->_valid, returnValue);
+      return returnValue;
+    }
+
+    /**
+     * @brief Moves to the next element.
+     * @return This iterator.
+     */
+    EEPROMArrayIterator& operator ++ ()
+    {
+      this->_index++;
+      return *this;
+    }
+
+    /**
+     * @brief Compares the position of two iterators.
+     * @return True if the iterators are at different elements.
+     */
+    bool operator != (EEPROMArrayIterator const& other) const
+    {
+      return this->_index != other._index;
+    }
+
+  protected:
+    const TArray& _array;
+    uint _index;
+    uint _block = (uint)-1;
+    bool _valid = false;
+    byte _data[TArray::BLOCK_BYTES + sizeof(typename TArray::checksum_t)];
+};
+
+/**
+ * @class EEPROMArray
+ * @brief An array of N values of type T stored in EEPROM.
+ * @details The elements are grouped in blocks of Block elements and each
+ * block is followed by its own checksum, so reading or writing an element
+ * only accesses its block. A Block of 1 (the default) gives each element
+ * its own checksum; a larger Block uses less EEPROM for checksums but
+ * reads and writes more bytes per element. An element of a block that has
+ * not been initialized reads as the default value.
+ *
+ *   EEPROMArray<uint16_t, 10> counters(0, 0);
+ *   counters[7] += 1;
+ *   for (uint16_t value : counters) { ... }
+ *
+ * @tparam T The type of the elements.
+ * @tparam N The number of elements.
+ * @tparam Block The number of elements covered by each checksum.
+ * @tparam TChecksum The checksum policy, Checksum<T> (default) or one
+ * of the CRC policies in EEPROM-CRC.h.
+ */
+template <typename T, uint N, uint Block = 1, typename TChecksum = Checksum<T>>
+class EEPROMArray
+{
+  static_assert(N > 0, "An EEPROMArray needs at least one element.");
+  static_assert(Block > 0 && Block <= N, "The block size must be between 1 and the number of elements.");
+
+  public:
+    typedef T value_type;                                ///< The type of the elements.
+    typedef typename TChecksum::checksum_t checksum_t;   ///< The type of the stored checksum.
+    typedef EEPROMArrayElement<EEPROMArray> Element;     ///< The type returned by operator[].
+    typedef EEPROMArrayIterator<EEPROMArray> Iterator;   ///< The type returned by begin() and end().
+
+    static const uint BLOCK = Block;                                              ///< The number of elements covered by each checksum.
+    static const uint BLOCK_BYTES = Block * sizeof(T);                            ///< The number of value bytes in a full block.
+    static const uint BLOCKS = (N + Block - 1) / Block;                           ///< The number of blocks.
+    static const uint LENGTH = N * sizeof(T) + BLOCKS * sizeof(checksum_t);       ///< The number of EEPROM bytes used.
+
+    /**
+     * @brief Initialize an instance of EEPROMArray with the specified address and default value.
+     * @param address The address (or index) of the first block within EEPROM.
+     * @param defaultValue The value returned for elements that have not been initialized.
+     */
+    EEPROMArray(const uint address, T defaultValue) : _defaultValue(defaultValue)
+    {
+      this->_address = min(address, EEPROMUtil.length() - 1);
+    }
+
+    /**
+     * @brief Gets an element that can be read, assigned and used with the
+     * operators of an EEPROM variable.
+     * @param index The index of the element, 0 to N - 1.
+     * @return The element.
+     */
+    Element operator [] (const uint index)
+    {
+      return Element(*this, index);
+    }
+
+    /**
+     * @brief Gets the value of an element.
+     * @param index The index of the element, 0 to N - 1.
+     * @return The value of the element.
+     */
+    T operator [] (const uint index) const
+    {
+      return this->get(index);
+    }
+
+    /**
+     * @brief Gets the value of an element.
+     * @details Reads the block holding the element and its checksum once.
+     * @param index The index of the element, 0 to N - 1.
+     * @return The stored value, or the default value if the block has not been initialized.
+     */
+    T get(uint index) const
+    {
+      byte data[BLOCK_BYTES + sizeof(checksum_t)];
+      bool valid = this->readBlock(index / Block, data);
+
+      T returnValue;
+      this->getElement(index, data, valid, returnValue);
+      return returnValue;
+    }
+
+    /**
+     * @brief Sets the value of an element.
+     * @details The block holding the element is read once, the element is replaced
+     * and only the changed bytes of the block and its checksum are written.
+     * The other elements of a block that has not been initialized are set to
+     * the default value.
+     * @param index The index of the element, 0 to N - 1.
+     * @param value The new value of the element.
+     * @return The new value.
+     */
+    T set(uint index, T const& value)
+    {
+      uint block = index / Block;
+      byte data[BLOCK_BYTES + sizeof(checksum_t)];
+      byte current[BLOCK_BYTES + sizeof(checksum_t)];
+
+      if (!this->readBlock(block, current))
+      {
+        this->fillData(data, this->_defaultValue, this->blockCount(block));
+      }
+      else
+      {
+        memcpy(data, current, this->blockCount(block) * sizeof(T));
+      }
+
+      memcpy(data + (index % Block) * sizeof(T), &value, sizeof(T));
+      this->writeBlock(block, data, current);
+      return value;
+    }
+
+    /**
+     * @brief Checks whether the block holding an element has been initialized.
+     * @param index The index of the element, 0 to N - 1.
+     * @return True if the checksum of the block is valid, false otherwise.
+     */
+    bool isInitialized(uint index) const
+    {
+      byte data[BLOCK_BYTES + sizeof(checksum_t)];
+      return this->readBlock(index / Block, data);
+    }
+
+    /**
+     * @brief Sets every element to the same value.
+     * @param value The value to store in each element.
+     */
+    void fill(T const& value)
+    {
+      byte data[BLOCK_BYTES + sizeof(checksum_t)];
+      this->fillData(data, value, Block);
+
+      for (uint block = 0; block < BLOCKS; block++)
+      {
+        this->writeBlock(block, data, nullptr);
+      }
+    }
+
+    /**
+     * @brief Copies a range of elements to RAM, reading each block once.
+     * @param values Receives count values.
+     * @param first The index of the first element to copy.
+     * @param count The number of elements to copy.
+     */
+    void copyTo(T* values, uint first, uint count) const
+    {
+      byte data[BLOCK_BYTES + sizeof(checksum_t)];
+      uint end = min(first + count, N);
+
+      for (uint i = first; i < end; )
+      {
+        uint block = i / Block;
+        bool valid = this->readBlock(block, data);
+
+        for (; i < end && i / Block == block; i++)
+        {
+          this->getElement(i, data, valid, values[i - first]);
+        }
+      }
+    }
+
+    /**
+     * @brief Copies a range of elements from RAM, writing each block once.
+     * @details A block that is only partly covered by the range is read first.
+     * @param values The count values to store.
+     * @param first The index of the first element to store.
+     * @param count The number of elements to store.
+     */
+    void copyFrom(const T* values, uint first, uint count)
+    {
+      byte data[BLOCK_BYTES + sizeof(checksum_t)];
+      byte current[BLOCK_BYTES + sizeof(checksum_t)];
+      uint end = min(first + count, N);
+
+      for (uint i = first; i < end; )
+      {
+        uint block = i / Block;
+        uint blockFirst = block * Block;
+        uint blockEnd = blockFirst + this->blockCount(block);
+        bool partial = (i > blockFirst || end < blockEnd);
+
+        if (partial && this->readBlock(block, current))
+        {
+          memcpy(data, current, this->blockCount(block) * sizeof(T));
+        }
+        else if (partial)
+        {
+          this->fillData(data, this->_defaultValue, this->blockCount(block));
+        }
+
+        for (; i < end && i < blockEnd; i++)
+        {
+          memcpy(data + (i - blockFirst) * sizeof(T), &values[i - first], sizeof(T));
+        }
+
+        this->writeBlock(block, data, partial ? current : nullptr);
+      }
+    }
+
+    /**
+     * @brief Sets all bytes of the array, including the checksums, to UNSET_VALUE.
+     */
+    void unset()
+    {
+      EEPROMUtil.fillBlock(this->_address, UNSET_VALUE, LENGTH);
+    }
+
+    /**
+     * @brief Gets an iterator at the first element.
+     */
+    Iterator begin() const
+    {
+      return Iterator(*this, 0);
+    }
+
+    /**
+     * @brief Gets an iterator after the last element.
+     */
+    Iterator end() const
+    {
+      return Iterator(*this, N);
+    }
+
+    /**
+     * @brief Gets the number of elements.
+     */
+    uint size() const
+    {
+      return N;
+    }
+
+    /**
+     * @brief Get the number of EEPROM bytes used by the array, including the checksums.
+     */
+    uint length() const
+    {
+      return LENGTH;
+    }
+
+    /**
+     * @brief Get the EEPROM address of the first block.
+     */
+    uint getAddress() const
+    {
+      return this->_address;
+    }
+
+    /**
+     * @brief Gets the next EEPROM address after this array.
+     */
+    uint nextAddress() const
+    {
+      return min(this->_address + LENGTH, EEPROMUtil.length() - 1);
+    }
+
+    /**
+     * @brief Reads a block and its checksum.
+     * @param block The index of the block.
+     * @param data Receives the value bytes of the block followed by its checksum.
+     * @return True if the checksum is valid, false otherwise.
+     */
+    bool readBlock(uint block, byte* data) const
+    {
+      uint length = this->blockCount(block) * sizeof(T);
+      EEPROMUtil.readBlock(this->blockAddress(block), data, length + sizeof(checksum_t));
+      checksum_t checksum = 0;
+
+      for (uint i = 0; i < sizeof(checksum_t); i++)
+      {
+        checksum |= (checksum_t)data[length + i] << (8 * i);
+      }
+
+      return TChecksum::get(data, length) == checksum;
+    }
+
+    /**
+     * @brief Copies an element from the bytes of its block.
+     * @param index The index of the element.
+     * @param data The value bytes of the block holding the element.
+     * @param valid True if the block is valid, false to use the default value.
+     * @param value Receives the value of the element.
+     */
+    void getElement(uint index, const byte* data, bool valid, T& value) const
+    {
+      if (valid)
+      {
+        memcpy(&value, data + (index % Block) * sizeof(T), sizeof(T));
+      }
+      else
+      {
+        value = this->_defaultValue;
+      }
+    }
+
+  protected:
+    uint _address;
+    T _defaultValue;
+
+    /**
+     * @brief Gets the number of elements in a block, which is less than Block for the last block.
+     */
+    uint blockCount(uint block) const
+    {
+      return min(Block, N - block * Block);
+    }
+
+    /**
+     * @brief Gets the EEPROM address of a block.
+     */
+    uint blockAddress(uint block) const
+    {
+      return this->_address + block * (BLOCK_BYTES + sizeof(checksum_t));
+    }
+
+    /**
+     * @brief Writes the changed bytes of a block followed by its checksum.
+     * @param block The index of the block.
+     * @param data The value bytes of the block, with room for the checksum.
+     * @param current The stored bytes of the block and checksum when they have
+     * already been read, or nullptr to read them again.
+     */
+    void writeBlock(uint block, byte* data, const byte* current)
+    {
+      uint length = this->blockCount(block) * sizeof(T);
+      checksum_t checksum = TChecksum::get(data, length);
+
+      for (uint i = 0; i < sizeof(checksum_t); i++)
+      {
+        data[length + i] = (byte)(checksum >> (8 * i));
+      }
+
+      if (current)
+      {
+        EEPROMUtil.writeChanges(this->blockAddress(block), data, current, length + sizeof(checksum_t), false);
+      }
+      else
+      {
+        EEPROMUtil.updateBlock(this->blockAddress(block), data, length + sizeof(checksum_t));
+      }
+    }
+
+    /**
+     * @brief Fills the value bytes of a block with one value.
+     */
+    static void fillData(byte* data, T const& value, uint count)
+    {
+      for (uint i = 0; i < count; i++)
+      {
+        memcpy(data + i * sizeof(T), &value, sizeof(T));
+      }
+    }
+};
+#endif
\ No newline at end of file
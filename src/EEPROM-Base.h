@@ -33,10 +33,34 @@
   #include <EEPROM.h>
 #elif defined(PARTICLE)
   #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
 #endif
 
 #include "EEPROM-Util.h"
 #include "EEPROM-Checksum.h"
+#include "EEPROM-CRC.h"
+#include "EEPROM-Registry.h"
+#include "EEPROM-Placement.h"
+#include "EEPROM-Operators.h"
+
+/**
+ * @brief An EEPROM address that has already been checked.
+ * @details Passing an EEPROMFixedAddress instead of an unsigned integer to
+ * the constructor of a variable stores the address as given, without
+ * normalizing it against the size of the EEPROM at runtime. EEPROMLayout
+ * produces these addresses after checking them at compile time.
+ */
+struct EEPROMFixedAddress
+{
+  /**
+   * @brief Wraps the given address.
+   * @param address The address (or index) within EEPROM.
+   */
+  constexpr explicit EEPROMFixedAddress(uint address) : value(address) {}
+
+  const uint value; ///< The wrapped address.
+};
 
 /**
  * @class EEPROMBase
@@ -47,12 +71,34 @@
  * the variable checksum, computing the next address for 
  * subsequent EEPROM variables, standard operator functionality,
  * and implicit conversion to the value type from the class instance.
+ * The operators (see EEPROMOperators) call get() and set() of the
+ * derived class TVariable directly (CRTP) instead of through virtual
+ * methods, so instances do not carry a vtable pointer and the calls
+ * can be inlined.
  * @tparam T The type of the variable stored.
+ * @tparam TChecksum The checksum policy, Checksum<T> or one of the
+ * CRC policies in EEPROM-CRC.h.
+ * @tparam TVariable The derived class, which provides get() and set().
+ * @tparam TPlacement Holds the address and default value, EEPROMPlacement<T>
+ * (default) in RAM or EEPROMStaticPlacement at compile time.
  */
-template <typename T>
-class EEPROMBase
+template <typename T, typename TChecksum, typename TVariable, typename TPlacement = EEPROMPlacement<T>>
+class EEPROMBase : public TPlacement, public EEPROMOperators<T, TVariable>
 {
   public:
+    typedef typename TChecksum::checksum_t checksum_t; ///< The type of the stored checksum.
+
+    static const uint LENGTH = sizeof(T) + sizeof(checksum_t); ///< The number of EEPROM bytes used, known at compile time.
+
+    /**
+     * @brief Initialize an instance of EEPROMBase<T> whose address and default
+     * value are given by an EEPROMStaticPlacement.
+     */
+    EEPROMBase()
+    {
+      static_assert(TPlacement::STATIC, "An address is required unless the placement is an EEPROMStaticPlacement.");
+    }
+
     /**
      * @brief Initialize an instance of EEPROMBase<T> with the specified address.
      * @param address The address (or index) of the variable within EEPROM.
@@ -72,6 +118,25 @@ class EEPROMBase
       this->_defaultValue = defaultValue;
     }
 
+    /**
+     * @brief Initialize an instance of EEPROMBase<T> with an address that is not normalized.
+     * @param address The checked address (or index) of the variable within EEPROM.
+     */
+    EEPROMBase(EEPROMFixedAddress address)
+    {
+      this->_address = address.value;
+    }
+
+    /**
+     * @brief Initialize an instance of EEPROMBase<T> with an address that is not normalized and a default value.
+     * @param address The checked address (or index) of the variable within EEPROM.
+     * @tparam defaultValue The default value returned when the variable has not been initialized.
+     */
+    EEPROMBase(EEPROMFixedAddress address, T defaultValue) : EEPROMBase(address)
+    {
+      this->_defaultValue = defaultValue;
+    }
+
     /**
      * @brief Implicitly converts the class instance to the value of type T. This 
      * allows the variable to be used on the right side of the equal sign.
@@ -79,7 +144,7 @@ class EEPROMBase
      */
     operator T()
     {
-      return this->get();
+      return this->variable().get();
     }
 
     /**
@@ -92,198 +157,56 @@ class EEPROMBase
     byte operator[] (const uint index)
     {
       uint address = this->normalizeAddress(this->getAddress() + index);
-      return EEPROM[address];
-    }
-
-    /**
-     * @brief Postfix increment operator.
-     * @return The value before incrementing as type T.
-     */
-    T operator ++ (int)
-    {
-      T oldValue = this->get();
-      this->set(oldValue + 1);
-      return oldValue;
-    }
-
-    /**
-     * @brief Prefix increment operator.
-     * @return The value after incrementing as type T.
-     */
-    T operator ++ ()
-    {
-      return this->set(this->get() + 1);
-    }
-
-    /**
-     * @brief Postfix decrement operator.
-     * @return The value before decrementing as type T.
-     */
-    T operator -- (int)
-    {
-      T oldValue = this->get();
-      this->set(this->get() - 1);
-      return oldValue;
-    }
-
-    /**
-     * @brief Postfix decrement operator.
-     * @return The value before decrementing as type T.
-     */
-    T operator -- ()
-    {
-      return this->set(this->get() - 1);
-    }
-
-    /**
-     * @brief Addition assignment operator.
-     * @param value The value to add.
-     * @return The result of the addition as type T.
-     */
-    T operator += (T const& value)
-    {
-      return this->set(this->get() + value);
-    }
-
-    /**
-     * @brief Subtraction assignment operator.
-     * @param value The value to subtract.
-     * @return The result of the subtraction as type T.
-     */
-    T operator -= (T const& value)
-    {
-      return this->set(this->get() - value);
-    }
-
-    /**
-     * @brief Multiplication assignment operator.
-     * @tparam value The value to multiply by.
-     * @return The result of the multiplication as type T.
-     */
-    T operator *= (T const& value)
-    {
-      return this->set(this->get() * value);
-    }
-
-    /**
-     * @brief Division assignment operator.
-     * @tparam value The value to divide by.
-     * @return The result of the division as type T.
-     */
-    T operator /= (T const& value)
-    {
-      return this->set(this->get() / value);
-    }
-
-    /**
-     * @brief Bitwise XOR assignment operator.
-     * @tparam value The value to XOR with.
-     * @return The result of the XOR operation as type T.
-     */
-    T operator ^= (T const& value)
-    {
-      return this->set(this->get() ^ value);
-    }
-
-    /**
-     * @brief Modulus assignment operator.
-     * @tparam value The value to mod with.
-     * @return The result of the modulus operation as type T.
-     */
-    T operator %= (T const& value)
-    {
-      return this->set(this->get() % value);
-    }
-
-    /**
-     * @brief Bitwise AND assignment operator.
-     * @tparam value The value to AND with.
-     * @return The result of the AND operation as type T.
-     */
-    T operator &= (T const& value)
-    {
-      return this->set(this->get() & value);
-    }
-
-    /**
-     * @brief Bitwise OR assignment operator.
-     * @tparam value The value to OR with.
-     * @return The result of the OR operation as type T.
-     */
-    T operator |= (T const& value)
-    {
-      return this->set(this->get() | value);
-    }
-
-    /**
-     * @brief Bitwise left shift assignment operator.
-     * @tparam value The value to shift by.
-     * @return The result of the left shift operation as type T.
-     */
-    T operator <<= (T const& value)
-    {
-      return this->set(this->get() << value);
+      return EEPROMUtil.readEEPROM(address);
     }
 
     /**
-     * @brief Bitwise right shift assignment operator.
-     * @tparam value The value to shift by.
-     * @return The result of the right shift operation as type T.
+     * @brief Read the variable value from the EEPROM using the address in this variable.
+     * @details The payload and the checksum byte are each read from EEPROM
+     * exactly once. The checksum is then validated against the bytes already
+     * in RAM rather than reading the EEPROM a second time.
+     * @return The value read from EEPROM as type T.
      */
-    T operator >>= (T const& value)
+    T read() const
     {
-      return this->set(this->get() >> value);
+      T returnValue;
+      this->read(returnValue);
+      return returnValue;
     }
 
     /**
-     * @brief Get the variable value.
-     * @return The current value of the variable as type T.
+     * @brief Read the variable value from the EEPROM using the address in this variable.
+     * @details Same as read() but also reports whether the stored checksum was valid.
+     * @param value Receives the value read from EEPROM or the default value if the
+     * variable has not been initialized.
+     * @return True if the EEPROM variable has been initialized, false otherwise.
      */
-    virtual T get() const
+    bool read(T& value) const
     {
       //
-      // Use default initialization.
+      // Read the payload directly into the bytes
+      // of the value (single pass).
       //
-      return T{};
-    }
-
-    /**
-     * @brief Set the variable value.
-     * @tparam value The new value to store in EEPROM.
-     * @return The stored value as type T.
-     */
-    virtual T set(T const& value)
-    {
-      return value;
-    }
-
-    /**
-     * @brief Read the variable value from the EEPROM using the address in this variable.
-     * @return The value read from EEPROM as type T.
-     */
-    T read() const
-    {
-      T returnValue;
+      byte* data = (byte*)&value;
+      EEPROMUtil.readBlock(this->_address, data, sizeof(T));
 
       //
-      // Check if the variable has been set or not
-      // by comparing the value to the not set value
-      // specified in the constructor.
+      // Check if the variable has been set or not by
+      // comparing the checksum of the bytes read to the
+      // stored checksum byte.
       //
-      if (this->isInitialized())
-      {
-        //
-        // Get the variable from EEPROM
-        // using the address this->_address.
-        //
-        EEPROM.get(this->_address, returnValue);
-      }
-      else
+      bool returnValue = (TChecksum::get(data, sizeof(T)) == this->checksumByte());
+
+      #if EEPROM_USE_REGISTRY
+      EEPROMRegistry.cache(this->_registryIndex, returnValue);
+      #endif
+
+      if (!returnValue)
       {
         //
         // Return the default value.
         //
-        returnValue = this->_defaultValue;
+        value = this->getDefaultValue();
       }
 
       return returnValue;
@@ -291,46 +214,59 @@ class EEPROMBase
 
     /**
      * @brief Write the value to the EEPROM using the address in this instance.
+     * @details Each byte of the value and checksum is read once and only written
+     * when it differs from the new value. On an external EEPROMDevice the changed
+     * bytes of each page are written together. When verify is true, only the bytes
+     * that were actually written are read back and compared. The checksum is
+     * computed over the whole value.
      * @tparam value The new value to store in EEPROM.
+     * @param verify True to read back and compare the bytes that changed.
+     * @return True if the write succeeded (or was not verified), false otherwise.
      */
-    void write(T const& value) const
+    bool write(T const& value, bool verify = false) const
     {
-      //
-      // Write the value to EEPROM using the put method. 
-      // Put uses EEPROM.update() to perform the write 
-      // so it will not rewrite the value if it didn't 
-      // change.
-      //
-      EEPROM.put(this->_address, value);
-
-      //
-      // Write the checksum.
-      //
-      byte checksum = Checksum<T>::get(value);
-      EEPROMUtil.updateEEPROM(this->checksumAddress(), checksum);
+      return this->writeValue((const byte*)&value, nullptr, false, verify);
     }
 
     /**
      * @brief Checks whether the EEPROM variable has been initialized.
      * @details Determines if the variable has been initialized by comparing the stored checksum to the actual checksum of the bytes stored.
+     * When EEPROM_USE_REGISTRY is true and the variable has been added to EEPROMRegistry the
+     * result is cached and the EEPROM is not read again until the variable is written or unset.
      * @return True if the EEPROM variable has been initialized, false otherwise.
      */
     bool isInitialized() const
     {
-      return (this->checksum() == this->checksumByte());
+      bool returnValue = false;
+
+      #if EEPROM_USE_REGISTRY
+      if (EEPROMRegistry.isKnown(this->_registryIndex))
+      {
+        returnValue = EEPROMRegistry.isValid(this->_registryIndex);
+      }
+      else
+      {
+        returnValue = (this->checksum() == this->checksumByte());
+        EEPROMRegistry.cache(this->_registryIndex, returnValue);
+      }
+      #else
+      returnValue = (this->checksum() == this->checksumByte());
+      #endif
+
+      return returnValue;
     }
 
     /**
      * @brief Returns the number of EEPROM bytes used.
-     * @details Returns the number of EEPROM bytes used by this instance including the checksum byte.
+     * @details Returns the number of EEPROM bytes used by this instance including the checksum bytes.
      * @return The number of bytes used in the EEPROM as an unsigned integer .
      */
     uint length() const
     {
       //
-      // The extra byte is the checksum byte.
+      // The extra bytes are the checksum bytes.
       //
-      return this->size() + 1;
+      return this->size() + sizeof(checksum_t);
     }
 
     /**
@@ -354,38 +290,39 @@ class EEPROMBase
      */
     void unset(byte unsetValue = UNSET_VALUE)
     {
-      for (uint i = 0; i < this->length(); i++)
-      {
-        uint address = this->normalizeAddress(this->_address + i);
-        EEPROMUtil.updateEEPROM(address, unsetValue);
-      }
+      #if EEPROM_USE_REGISTRY
+      EEPROMRegistry.forget(this->_registryIndex);
+      #endif
+
+      EEPROMUtil.fillBlock(this->_address, unsetValue, this->length());
     }
 
     /**
-     * @brief Gets the address of the checksum byte in EEPROM for this variable.
+     * @brief Gets the address of the (first) checksum byte in EEPROM for this variable.
      * @return The EEPROM address of the checksum as an unsigned integer.
      */
     uint checksumAddress() const
     {
-      return this->normalizeAddress(this->_address + this->length() - 1);
+      return this->normalizeAddress(this->_address + this->size());
     }
 
     /**
-     * @brief Gets the stored checksum byte.
-     * @return The checksum value read from EEPROM for this variable as a byte.
+     * @brief Gets the stored checksum.
+     * @details With the default Checksum<T> policy this is a single byte.
+     * @return The checksum value read from EEPROM for this variable.
      */
-    byte checksumByte() const
+    checksum_t checksumByte() const
     {
-      return EEPROM.read(this->checksumAddress());
+      return this->readChecksum(this->checksumAddress());
     }
 
     /**
      * @brief Calculate the checksum of the data in the EEPROM for this instance.
-     * @return The calculated checksum as a byte.
+     * @return The calculated checksum.
      */
-    byte checksum() const
+    checksum_t checksum() const
     {
-      return Checksum<T>::getEEPROM(this->getAddress(), sizeof(T));
+      return TChecksum::getEEPROM(this->getAddress(), sizeof(T));
     }
 
     /**
@@ -396,7 +333,7 @@ class EEPROMBase
       for (uint i = 0; i < length; i++)
       {
         uint address = this->normalizeAddress(this->_address + i);
-        data[i] = EEPROM[address];
+        data[i] = EEPROMUtil.readEEPROM(address);
       }
     }
 
@@ -419,37 +356,188 @@ class EEPROMBase
       return this->normalizeAddress(this->getAddress() + this->length());
     }
 
+  protected:
     /**
-     * @brief Gets the default value for this instance.
-     * @return The default value as type T.
+     * @brief Writes a single byte to EEPROM if it differs from the stored byte.
+     * @param address The address in EEPROM to write the value in.
+     * @param value The value to write to the EEPROM.
+     * @param verify True to read back and compare the byte after it is written.
+     * @return False if the byte was verified and did not match, true otherwise.
      */
-    T getDefaultValue() const
+    bool writeByte(uint address, byte value, bool verify) const
     {
-      return this->_defaultValue;
+      bool returnValue = true;
+
+      if (EEPROMUtil.readEEPROM(address) != value)
+      {
+        EEPROMUtil.writeEEPROM(address, value);
+
+        if (verify)
+        {
+          returnValue = (EEPROMUtil.readEEPROM(address) == value);
+        }
+      }
+
+      return returnValue;
     }
 
-  protected:
     /**
-     * @brief The address of this variable in the EEPROM.
-     * @details This variable cannot/will not be modified after instantiation.
+     * @brief Writes the changed bytes of a value followed by its checksum.
+     * @details The stored bytes are read one segment at a time. A segment ends at a page
+     * boundary of an EEPROMDevice, after EEPROM_DEVICE_BUFFER bytes or where the dirty
+     * state changes, and only its changed bytes are written. If the caller knows that the
+     * stored checksum is valid it is updated from the changed bytes with TChecksum::replace(),
+     * otherwise it is computed over the whole value. A registry entry is not enough, the
+     * EEPROM may have been changed by another instance since it was cached. The last segment is written
+     * together with the checksum so a device page holding both is written once.
+     * @param data The bytes of the new value.
+     * @param dirty One bit per EEPROM_DIRTY_BLOCK_SIZE bytes that may have changed, or
+     * nullptr when any byte may have changed. Bytes in clean blocks are not read.
+     * @param valid True if the caller checked the stored checksum against the stored
+     * value or wrote both itself, so that no other write can have changed them since.
+     * @param verify True to read back and compare the bytes that changed.
+     * @return True if the write succeeded (or was not verified), false otherwise.
+     */
+    bool writeValue(const byte* data, const byte* dirty, bool valid, bool verify) const
+    {
+      bool returnValue = true;
+      uint pageSize = EEPROMUtil.pageSize();
+      checksum_t stored = this->checksumByte();
+      checksum_t checksum = stored;
+      bool incremental = valid;
+      byte current[EEPROM_DEVICE_BUFFER + sizeof(checksum_t)];
+      byte image[EEPROM_DEVICE_BUFFER + sizeof(checksum_t)];
+      uint tail = sizeof(T);
+
+      #if EEPROM_USE_REGISTRY
+      EEPROMRegistry.forget(this->_registryIndex);
+      #endif
+
+      for (uint i = 0; i < sizeof(T); )
+      {
+        uint limit = (pageSize > 1) ? pageSize - ((this->_address + i) % pageSize) : (uint)EEPROM_DEVICE_BUFFER;
+        uint count = min(min(sizeof(T) - i, limit), (uint)EEPROM_DEVICE_BUFFER);
+        bool changed = !dirty || this->isMarked(dirty, i);
+
+        if (dirty)
+        {
+          //
+          // Stop the segment where the dirty state changes.
+          //
+          for (uint j = 1; j < count; j++)
+          {
+            if (this->isMarked(dirty, i + j) != changed)
+            {
+              count = j;
+              break;
+            }
+          }
+        }
+
+        if (changed)
+        {
+          EEPROMUtil.readBlock(this->_address + i, current, count);
+
+          if (incremental && memcmp(current, data + i, count) != 0)
+          {
+            incremental = TChecksum::replace(checksum, i, current, data + i, count);
+          }
+
+          if (i + count < sizeof(T))
+          {
+            returnValue = EEPROMUtil.writeChanges(this->_address + i, data + i, current, count, verify) && returnValue;
+          }
+          else
+          {
+            //
+            // Keep the last segment to write it with the checksum.
+            //
+            tail = i;
+          }
+        }
+
+        i += count;
+      }
+
+      if (!incremental)
+      {
+        checksum = TChecksum::get((byte*)data, sizeof(T));
+      }
+
+      uint count = sizeof(T) - tail;
+      memcpy(image, data + tail, count);
+      this->putChecksum(image + count, checksum);
+      this->putChecksum(current + count, stored);
+      returnValue = EEPROMUtil.writeChanges(this->_address + tail, image, current, count + sizeof(checksum_t), verify) && returnValue;
+
+      #if EEPROM_USE_REGISTRY
+      if (returnValue)
+      {
+        EEPROMRegistry.cache(this->_registryIndex, true);
+      }
+      #endif
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Checks the dirty bit of the block holding a byte of the value.
+     * @param dirty One bit per EEPROM_DIRTY_BLOCK_SIZE bytes of the value.
+     * @param index The index of the byte in the value.
+     * @return True if the block is marked, false otherwise.
      */
-    uint _address = 0;
+    static bool isMarked(const byte* dirty, uint index)
+    {
+      uint block = index / EEPROM_DIRTY_BLOCK_SIZE;
+      return (dirty[block / 8] & (1 << (block % 8))) != 0;
+    }
+
+    /**
+     * @brief Reads a checksum stored least significant byte first.
+     * @param address The address in EEPROM of the first checksum byte.
+     * @return The checksum read from EEPROM.
+     */
+    checksum_t readChecksum(uint address) const
+    {
+      byte data[sizeof(checksum_t)];
+      EEPROMUtil.readBlock(address, data, sizeof(checksum_t));
+      checksum_t returnValue = 0;
+
+      for (uint i = 0; i < sizeof(checksum_t); i++)
+      {
+        returnValue |= (checksum_t)data[i] << (8 * i);
+      }
 
-   /**
-     * @brief The default value.
-     * @details The default value to return when the EEPROM has not 
-     * been initialized. The address of this variable in the EEPROM. 
-     * This variable cannot/will not be modified after instantiation.
+      return returnValue;
+    }
+
+    /**
+     * @brief Writes a checksum least significant byte first.
+     * @param address The address in EEPROM of the first checksum byte.
+     * @param checksum The checksum to write.
+     * @param verify True to read back and compare the bytes after they are written.
+     * @return False if a byte was verified and did not match, true otherwise.
      */
-    T _defaultValue;
+    bool writeChecksum(uint address, checksum_t checksum, bool verify) const
+    {
+      byte data[sizeof(checksum_t)];
+      this->putChecksum(data, checksum);
+      return EEPROMUtil.updateBlock(address, data, sizeof(checksum_t), verify);
+    }
 
     /**
-     * @brief Computes the checksum of the given value.
-     * @tparam value The value to compute the checksum for.
-     * @return The computed checksum as a byte.
+     * @brief Stores a checksum least significant byte first in a buffer.
+     * @param data The buffer, which must hold sizeof(checksum_t) bytes.
+     * @param checksum The checksum to store.
      */
-    byte computeChecksum(T value);
-    
+    static void putChecksum(byte* data, checksum_t checksum)
+    {
+      for (uint i = 0; i < sizeof(checksum_t); i++)
+      {
+        data[i] = (byte)(checksum >> (8 * i));
+      }
+    }
+
     /**
      * @brief Normalize the given EEPROM address to ensure it is within valid range.
      * @param address The address to normalize.
@@ -457,7 +545,7 @@ class EEPROMBase
      */
     uint normalizeAddress(uint address) const
     {
-      return min(address, EEPROM.length() - 1);
+      return min(address, EEPROMUtil.length() - 1);
     }
 };
 #endif
\ No newline at end of file
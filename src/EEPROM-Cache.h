@@ -33,10 +33,14 @@
   #include <EEPROM.h>
 #elif defined(PARTICLE)
   #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
 #endif
 
 #include "EEPROM-Base.h"
 
+class EEPROMTransaction;
+
 /**
  * @class EEPROMCache
  * @brief Provides indirect access to an EEPROM variable.
@@ -48,16 +52,30 @@
  * to commit() is required to write the value to EEPROM. This version
  * will perform faster and have less ware on the delicate EEPROM memory.
  * @tparam T The type of the variable stored.
+ * @tparam TChecksum The checksum policy, Checksum<T> (default) or one
+ * of the CRC policies in EEPROM-CRC.h.
+ * @tparam TPlacement Holds the address and default value, see EEPROM-Placement.h.
  */
-template <typename T>
-class EEPROMCache : public EEPROMBase<T>
+template <typename T, typename TChecksum = Checksum<T>, typename TPlacement = EEPROMPlacement<T>>
+class EEPROMCache : public EEPROMBase<T, TChecksum, EEPROMCache<T, TChecksum, TPlacement>, TPlacement>
 {
   public:
+    /**
+     * @brief Initialize an instance of EEPROMCache<T> with an EEPROMStaticPlacement.
+     */
+    EEPROMCache()
+    {
+      //
+      // Read the current value from EEPROM.
+      //
+      this->restore();
+    }
+
     /**
      * @brief Initialize an instance of EEPROMCache<T> with the specified address.
      * @param address The address (or index) of the variable within EEPROM.
      */
-    EEPROMCache(const uint address) : EEPROMBase<T>(address)
+    EEPROMCache(const uint address) : EEPROMBase<T, TChecksum, EEPROMCache<T, TChecksum, TPlacement>, TPlacement>(address)
     {
       //
       // Read the current value from EEPROM.
@@ -70,9 +88,43 @@ class EEPROMCache : public EEPROMBase<T>
      * @param address The address (or index) of the variable within EEPROM.
      * @tparam value The initial value of the variable before restore() is called.
      */
-    EEPROMCache(const uint address, T value) : EEPROMBase<T>(address, value)
+    EEPROMCache(const uint address, T value) : EEPROMBase<T, TChecksum, EEPROMCache<T, TChecksum, TPlacement>, TPlacement>(address, value)
     {
       this->_value = value;
+
+      //
+      // The contents of the EEPROM are unknown
+      // until restore() is called.
+      //
+      this->markDirty();
+    }
+
+    /**
+     * @brief Initialize an instance of EEPROMCache<T> with an address checked by EEPROMLayout.
+     * @param address The checked address (or index) of the variable within EEPROM.
+     */
+    EEPROMCache(EEPROMFixedAddress address) : EEPROMBase<T, TChecksum, EEPROMCache<T, TChecksum, TPlacement>, TPlacement>(address)
+    {
+      //
+      // Read the current value from EEPROM.
+      //
+      this->restore();
+    }
+
+    /**
+     * @brief Initialize an instance of EEPROMCache<T> with an address checked by EEPROMLayout and initial value.
+     * @param address The checked address (or index) of the variable within EEPROM.
+     * @tparam value The initial value of the variable before restore() is called.
+     */
+    EEPROMCache(EEPROMFixedAddress address, T value) : EEPROMBase<T, TChecksum, EEPROMCache<T, TChecksum, TPlacement>, TPlacement>(address, value)
+    {
+      this->_value = value;
+
+      //
+      // The contents of the EEPROM are unknown
+      // until restore() is called.
+      //
+      this->markDirty();
     }
     
     /**
@@ -82,7 +134,7 @@ class EEPROMCache : public EEPROMBase<T>
      * @tparam item The new value to store in EEPROM.
      * @return A reference to the EEPROMCache<T> variable.
      */
-    EEPROMCache<T>& operator = (T const& value)
+    EEPROMCache<T, TChecksum, TPlacement>& operator = (T const& value)
     {
       this->set(value);
       return *this;
@@ -94,7 +146,7 @@ class EEPROMCache : public EEPROMBase<T>
      * @tparam item The new value to store in EEPROM.
      * @return A reference to the EEPROMCache<T> variable.
      */
-    EEPROMCache<T>& operator = (EEPROMCache<T> const& item)
+    EEPROMCache<T, TChecksum, TPlacement>& operator = (EEPROMCache<T, TChecksum, TPlacement> const& item)
     {
       this->set(item.get());
       return *this;
@@ -116,6 +168,21 @@ class EEPROMCache : public EEPROMBase<T>
      */
     T set(T const& value)
     {
+      //
+      // Mark the blocks whose bytes changed.
+      //
+      const byte* current = (const byte*)&this->_value;
+      const byte* data = (const byte*)&value;
+
+      for (uint i = 0; i < sizeof(T); i++)
+      {
+        if (current[i] != data[i])
+        {
+          uint block = i / EEPROM_DIRTY_BLOCK_SIZE;
+          this->_dirty[block / 8] |= (1 << (block % 8));
+        }
+      }
+
       this->_value = value;
       return this->_value;
     }
@@ -127,23 +194,130 @@ class EEPROMCache : public EEPROMBase<T>
     T restore()
     {
       //
-      // Read the current value from EEPROM.
+      // Read the current value from EEPROM. If the variable
+      // has not been initialized the default value is cached
+      // and has to be written by the next commit().
       //
-      this->_value = this->read();
+      if (this->read(this->_value))
+      {
+        this->markClean();
+      }
+      else
+      {
+        this->markDirty();
+      }
+
       return this->_value;
     }
 
     /**
      * @brief Commit the cached value to the EEPROM.
+     * @details Only the blocks changed by set() since the last restore()
+     * or commit() are written. When nothing changed the EEPROM is not
+     * accessed at all.
      * @return The value as type T.
      */
     T commit()
     {
-      this->write(this->_value);
+      if (this->isDirty())
+      {
+        //
+        // The checksum can only be updated from the dirty blocks
+        // when restore() checked it or commit() wrote it.
+        //
+        this->writeValue((const byte*)&this->_value, this->_dirty, this->_stored, false);
+        this->markClean();
+      }
+
       return this->_value;
     }
 
+    /**
+     * @brief Unset the variable.
+     * @details Change the EEPROM values back to UNSET_VALUE as if the variable has never
+     * been written to the EEPROM. The cached value is kept and the next commit() writes
+     * all of it.
+     */
+    void unset(byte unsetValue = UNSET_VALUE)
+    {
+      EEPROMBase<T, TChecksum, EEPROMCache<T, TChecksum, TPlacement>, TPlacement>::unset(unsetValue);
+      this->markDirty();
+    }
+
+    /**
+     * @brief Checks whether the cached value has changed since the last restore() or commit().
+     * @return True if commit() has bytes to write, false otherwise.
+     */
+    bool isDirty() const
+    {
+      bool returnValue = false;
+
+      for (uint i = 0; i < sizeof(this->_dirty); i++)
+      {
+        if (this->_dirty[i] != 0)
+        {
+          returnValue = true;
+          break;
+        }
+      }
+
+      return returnValue;
+    }
+
   protected:
+    friend class EEPROMTransaction;
+
     T _value; ///< The cached value of the EEPROM variable.
+
+    /**
+     * @brief One bit per block of EEPROM_DIRTY_BLOCK_SIZE bytes of T that
+     * has changed since the last restore() or commit().
+     */
+    byte _dirty[((sizeof(T) + EEPROM_DIRTY_BLOCK_SIZE - 1) / EEPROM_DIRTY_BLOCK_SIZE + 7) / 8];
+
+    /**
+     * @brief True when the EEPROM holds the cached value and a valid checksum
+     * because restore() checked it or commit() wrote it.
+     */
+    bool _stored = false;
+
+    /**
+     * @brief Marks every block as changed and the stored checksum as unknown.
+     */
+    void markDirty()
+    {
+      memset(this->_dirty, 0xFF, sizeof(this->_dirty));
+      this->_stored = false;
+    }
+
+    /**
+     * @brief Marks every block as unchanged and the stored checksum as valid.
+     */
+    void markClean()
+    {
+      memset(this->_dirty, 0, sizeof(this->_dirty));
+      this->_stored = true;
+    }
+
+    /**
+     * @brief Checks whether the block containing the given byte of T has changed.
+     * @param index The index of the byte within T.
+     * @return True if the block is dirty, false otherwise.
+     */
+    bool isDirtyByte(uint index) const
+    {
+      return this->isMarked(this->_dirty, index);
+    }
 };
+
+/**
+ * @brief An EEPROMCache<T> whose address and default value are known at
+ * compile time, so that an instance only uses RAM for the cached value.
+ * @tparam T The type of the variable stored.
+ * @tparam Address The address of the variable within EEPROM.
+ * @tparam TDefault Provides the default value, see EEPROM-Placement.h.
+ * @tparam TChecksum The checksum policy.
+ */
+template <typename T, uint Address, typename TDefault = EEPROMDefault<T>, typename TChecksum = Checksum<T>>
+using EEPROMStaticCache = EEPROMCache<T, TChecksum, EEPROMStaticPlacement<T, Address, TDefault>>;
 #endif
\ No newline at end of file
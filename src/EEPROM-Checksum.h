@@ -32,13 +32,20 @@
   #include <Arduino.h>
 #elif defined(PARTICLE)
   #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
 #endif
 
+#include "EEPROM-Vars.h"
+#include "EEPROM-Util.h"
+
 /**
  * @class Checksum
  * @brief Provides checksum calculation options.
  * @details Computes a single-byte checksum on any data 
- * type or directly from an EEPROM address.
+ * type or directly from an EEPROM address. The bytes are
+ * folded one at a time or, when EEPROM_WIDE_CHECKSUM is
+ * true, one machine word at a time with the same result.
  * @tparam T The type of the variable against whose value 
  * the checksum will be calculated.
  */
@@ -46,6 +53,8 @@ template <typename T>
 class Checksum
 {
   public:
+    typedef byte checksum_t; ///< The type of the computed checksum.
+
     /**
      * @brief Calculate the checksum of a byte array.
      * @details Calculate the checksum of the byte array specified by 
@@ -55,7 +64,7 @@ class Checksum
      * @param length The length of the byte array.
      * @return The calculated checksum as a byte.
      */
-    static byte get(byte* data, uint length)
+    static checksum_t get(byte* data, uint length)
     {
       byte returnValue = 0;
 
@@ -69,34 +78,23 @@ class Checksum
       }
       else
       {
-        for (uint i = 0; i < length ; i++)
-        {
-          byte b = data[i];
-          returnValue ^= b;
-        }
-      }
-
-      //
-      // Do not let the checksum be UNSET_VALUE
-      //
-      if (returnValue == UNSET_VALUE)
-      {
-        returnValue <<= 1;
+        returnValue = Checksum<T>::fold(data, length);
       }
 
-      return returnValue;
+      return Checksum<T>::finish(returnValue);
     }
 
     /**
      * @brief Calculates the checksum from data in the EEPROM.
      * @details Calculate the checksum of the byte array in EEPROM
      * specified by the address parameter whose number of bytes 
-     * is specified by the length parameter.
+     * is specified by the length parameter. The bytes are read in
+     * chunks of EEPROM_CHECKSUM_CHUNK into a buffer on the stack.
      * @param address The EEPROM address of the first byte of the array.
      * @param length The number of EEPROM bytes to read.
      * @return The calculated checksum as a byte.
      */
-    static byte getEEPROM(uint address, uint length)
+    static checksum_t getEEPROM(uint address, uint length)
     {
       byte returnValue = 0;
 
@@ -106,26 +104,22 @@ class Checksum
         // For a single byte use the bit
         // pattern 0xAA (10101010).
         //
-        returnValue = 0xAA ^ EEPROM[address];
+        returnValue = 0xAA ^ EEPROMUtil.readEEPROM(address);
       }
       else
       {
-        for (uint i = 0; i < length ; i++)
+        byte buffer[EEPROM_CHECKSUM_CHUNK];
+
+        for (uint i = 0; i < length; i += EEPROM_CHECKSUM_CHUNK)
         {
-          byte b = EEPROM[address + i];
-          returnValue ^= b;
-        }
-      }
+          uint count = min(length - i, (uint)EEPROM_CHECKSUM_CHUNK);
+          EEPROMUtil.readBlock(address + i, buffer, count);
 
-      //
-      // Do not let the checksum be UNSET_VALUE
-      //
-      if (returnValue == UNSET_VALUE)
-      {
-        returnValue <<= 1;
+          returnValue ^= Checksum<T>::fold(buffer, count);
+        }
       }
 
-      return returnValue;
+      return Checksum<T>::finish(returnValue);
     }
 
     /**
@@ -133,7 +127,7 @@ class Checksum
      * @param value The value whose checksum will be calculated.
      * @return The calculated checksum as a byte.
      */
-    static byte get(T value)
+    static checksum_t get(T value)
     {
       //
       // Get a pointer to the bytes in memory
@@ -146,5 +140,120 @@ class Checksum
       //
       return Checksum<T>::get(ptr, sizeof(T));
     }
+
+    /**
+     * @brief XOR all of the bytes in the array one byte at a time.
+     * @param data Points to the starting byte in the array.
+     * @param length The length of the byte array.
+     * @return The XOR of all of the bytes.
+     */
+    static byte foldBytes(const byte* data, uint length)
+    {
+      byte returnValue = 0;
+
+      for (uint i = 0; i < length; i++)
+      {
+        returnValue ^= data[i];
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief XOR all of the bytes in the array one machine word at a time.
+     * @details The unaligned bytes before the first and after the last
+     * whole word are folded one at a time. Since XOR does not depend on
+     * the order of the bytes, folding the bytes of the accumulated word
+     * gives the same result as foldBytes().
+     * @param data Points to the starting byte in the array.
+     * @param length The length of the byte array.
+     * @return The XOR of all of the bytes.
+     */
+    static byte foldWords(const byte* data, uint length)
+    {
+      typedef uintptr_t wide_t;
+
+      //
+      // Fold the bytes before the first aligned word.
+      //
+      uint head = (sizeof(wide_t) - ((uintptr_t)data % sizeof(wide_t))) % sizeof(wide_t);
+      head = min(head, length);
+      byte returnValue = Checksum<T>::foldBytes(data, head);
+
+      //
+      // Fold the aligned words.
+      //
+      wide_t accumulator = 0;
+      uint i = head;
+
+      for (; i + sizeof(wide_t) <= length; i += sizeof(wide_t))
+      {
+        wide_t w;
+        memcpy(&w, data + i, sizeof(wide_t));
+        accumulator ^= w;
+      }
+
+      for (uint shift = (sizeof(wide_t) * 8) / 2; shift >= 8; shift /= 2)
+      {
+        accumulator ^= accumulator >> shift;
+      }
+
+      returnValue ^= (byte)accumulator;
+
+      //
+      // Fold the bytes after the last whole word.
+      //
+      return returnValue ^ Checksum<T>::foldBytes(data + i, length - i);
+    }
+
+    /**
+     * @brief Updates a stored checksum after a range of bytes of the value changed.
+     * @details The XOR of the old bytes is removed and the XOR of the new bytes is
+     * added, so the rest of the value does not have to be read. This is not possible
+     * when T is a single byte or when the checksum is the shifted UNSET_VALUE (0xFE),
+     * which may stand for an XOR of either 0xFE or 0xFF.
+     * @param checksum The stored checksum, which receives the new checksum.
+     * @param offset The offset of the changed bytes within the value.
+     * @param oldData The bytes before the change.
+     * @param newData The bytes after the change.
+     * @param length The number of bytes changed.
+     * @return True if the checksum was updated, false if it has to be recomputed.
+     */
+    static bool replace(checksum_t& checksum, uint offset, const byte* oldData, const byte* newData, uint length)
+    {
+      bool returnValue = false;
+      (void)offset;
+
+      if (sizeof(T) > 1 && checksum != (byte)(UNSET_VALUE << 1))
+      {
+        checksum = Checksum<T>::finish(checksum ^ Checksum<T>::fold(oldData, length) ^ Checksum<T>::fold(newData, length));
+        returnValue = true;
+      }
+
+      return returnValue;
+    }
+
+  protected:
+    /**
+     * @brief XOR all of the bytes in the array with the kernel
+     * selected by EEPROM_WIDE_CHECKSUM.
+     */
+    static byte fold(const byte* data, uint length)
+    {
+      return EEPROM_WIDE_CHECKSUM ? Checksum<T>::foldWords(data, length) : Checksum<T>::foldBytes(data, length);
+    }
+
+    /**
+     * @brief Do not let the checksum be UNSET_VALUE.
+     */
+    static byte finish(byte checksum)
+    {
+      if (checksum == UNSET_VALUE)
+      {
+        checksum <<= 1;
+      }
+
+      return checksum;
+    }
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,454 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_COMPRESSED_H
+#define EEPROM_COMPRESSED_H
+
+/**
+ * @file EEPROM-Compressed.h
+ * @brief This file contains the EEPROMCompressed<T, Capacity> definition.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+  #include <EEPROM.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+#include "EEPROM-Base.h"
+
+//
+// The largest run of zero bytes or literal bytes described by one token.
+//
+#define EEPROM_COMPRESSED_RUN 128
+
+/**
+ * @class EEPROMCompressed
+ * @brief Provides direct access to an EEPROM variable stored as a
+ * zero-run encoded image.
+ * @details The stored image is a two byte length (least significant
+ * byte first), the checksum of the uncompressed value and the encoded
+ * bytes. Each token of the encoding is either 0x80 | (n - 1) for a run
+ * of n zero bytes or n - 1 followed by n literal bytes, with n up to
+ * EEPROM_COMPRESSED_RUN. Values that are mostly zero bytes and small
+ * integers need far fewer EEPROM bytes to be read and written. The
+ * image is encoded and decoded EEPROM_DEVICE_BUFFER bytes at a time so
+ * no second copy of the value is held in RAM. Apart from its length
+ * this class can be used in place of EEPROMStorage<T>, except for the
+ * methods that expose the bytes of an uncompressed value and checksum
+ * (checksumByte(), checksum(), copyTo() and operator[]).
+ * @tparam T The type of the variable stored.
+ * @tparam Capacity The number of EEPROM bytes reserved for the encoded
+ * bytes. The default fits any value; a smaller capacity saves EEPROM but
+ * a value whose encoding does not fit is not written.
+ * @tparam TChecksum The checksum policy, Checksum<T> (default) or one
+ * of the CRC policies in EEPROM-CRC.h.
+ */
+template <typename T, uint Capacity = sizeof(T) + ((sizeof(T) + EEPROM_COMPRESSED_RUN - 1) / EEPROM_COMPRESSED_RUN), typename TChecksum = Checksum<T>>
+class EEPROMCompressed : public EEPROMBase<T, TChecksum, EEPROMCompressed<T, Capacity, TChecksum>>
+{
+  static_assert(Capacity > 0 && Capacity <= 0xFFFF, "EEPROMCompressed requires a capacity between 1 and 65535 bytes.");
+
+  public:
+    typedef typename EEPROMBase<T, TChecksum, EEPROMCompressed<T, Capacity, TChecksum>>::checksum_t checksum_t; ///< The type of the stored checksum.
+
+    static const uint HEADER_LENGTH = 2 + sizeof(checksum_t); ///< The number of bytes of the length and checksum.
+    static const uint LENGTH = HEADER_LENGTH + Capacity; ///< The number of EEPROM bytes used, known at compile time.
+
+    /**
+     * @brief Initialize an instance of EEPROMCompressed<T, Capacity> with the specified address.
+     * @param address The address (or index) of the variable within EEPROM.
+     */
+    EEPROMCompressed(const uint address) : EEPROMBase<T, TChecksum, EEPROMCompressed<T, Capacity, TChecksum>>(address)
+    {
+    }
+
+    /**
+     * @brief Initialize an instance of EEPROMCompressed<T, Capacity> with the specified address and default value.
+     * @param address The address (or index) of the variable within EEPROM.
+     * @tparam defaultValue The default value returned when the variable has not been initialized.
+     */
+    EEPROMCompressed(const uint address, T defaultValue) : EEPROMBase<T, TChecksum, EEPROMCompressed<T, Capacity, TChecksum>>(address, defaultValue)
+    {
+    }
+
+    /**
+     * @brief Initialize an instance of EEPROMCompressed<T, Capacity> with an address checked by EEPROMLayout.
+     * @param address The checked address (or index) of the variable within EEPROM.
+     */
+    EEPROMCompressed(EEPROMFixedAddress address) : EEPROMBase<T, TChecksum, EEPROMCompressed<T, Capacity, TChecksum>>(address)
+    {
+    }
+
+    /**
+     * @brief Initialize an instance of EEPROMCompressed<T, Capacity> with an address checked by EEPROMLayout and a default value.
+     * @param address The checked address (or index) of the variable within EEPROM.
+     * @tparam defaultValue The default value returned when the variable has not been initialized.
+     */
+    EEPROMCompressed(EEPROMFixedAddress address, T defaultValue) : EEPROMBase<T, TChecksum, EEPROMCompressed<T, Capacity, TChecksum>>(address, defaultValue)
+    {
+    }
+
+    /**
+     * @brief Allows assignment of a variable of type T value to be
+     * this instance's value.
+     * @details Accounts for EEPROMCompressed<T, Capacity> = T.
+     * @tparam item The new value to store in EEPROM.
+     * @return A reference to the EEPROMCompressed<T, Capacity> variable.
+     */
+    EEPROMCompressed<T, Capacity, TChecksum>& operator = (T const& value)
+    {
+      this->set(value);
+      return *this;
+    }
+
+    /**
+     * @brief Allows assignment of one EEPROMCompressed<T, Capacity> value to another.
+     * @details Accounts for EEPROMCompressed<T, Capacity> = EEPROMCompressed<T, Capacity>.
+     * @tparam item The new value to store in EEPROM.
+     * @return A reference to the EEPROMCompressed<T, Capacity> variable.
+     */
+    EEPROMCompressed<T, Capacity, TChecksum>& operator = (EEPROMCompressed<T, Capacity, TChecksum> const& item)
+    {
+      this->set(item.get());
+      return *this;
+    }
+
+    /**
+     * @brief Get the variable value.
+     * @return The current value of the variable as type T.
+     */
+    T get() const
+    {
+      T returnValue;
+      this->read(returnValue);
+      return returnValue;
+    }
+
+    /**
+     * @brief Set the variable value.
+     * @details The value is not written if its encoding does not fit in Capacity bytes.
+     * @tparam value The new value to store in EEPROM.
+     * @return The value as type T.
+     */
+    T set(T const& value)
+    {
+      this->write(value);
+      return value;
+    }
+
+    /**
+     * @brief Read and decode the variable value.
+     * @param value Receives the value read from EEPROM or the default value if the
+     * variable has not been initialized.
+     * @return True if the EEPROM variable has been initialized, false otherwise.
+     */
+    bool read(T& value) const
+    {
+      byte header[HEADER_LENGTH];
+      EEPROMUtil.readBlock(this->_address, header, HEADER_LENGTH);
+      uint length = header[0] | ((uint)header[1] << 8);
+
+      bool returnValue = (length <= Capacity) && this->decode(length, value);
+
+      if (returnValue)
+      {
+        //
+        // Compare against the checksum bytes already read.
+        //
+        byte checksum[sizeof(checksum_t)];
+        this->putChecksum(checksum, TChecksum::get((byte*)&value, sizeof(T)));
+        returnValue = (memcmp(checksum, header + 2, sizeof(checksum_t)) == 0);
+      }
+
+      if (!returnValue)
+      {
+        value = this->getDefaultValue();
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Encode and write the variable value.
+     * @details The encoded bytes are written first and the length and checksum
+     * last. Only the bytes that differ from the stored image are written.
+     * @tparam value The new value to store in EEPROM.
+     * @param verify True to read back and compare the bytes that changed.
+     * @return False if the encoding does not fit in Capacity bytes or a verified
+     * byte did not match, true otherwise.
+     */
+    bool write(T const& value, bool verify = false) const
+    {
+      const byte* data = (const byte*)&value;
+      uint length = EEPROMCompressed<T, Capacity, TChecksum>::encodedLength(value);
+      bool returnValue = (length <= Capacity);
+
+      if (returnValue)
+      {
+        byte buffer[EEPROM_DEVICE_BUFFER];
+        uint count = 0;
+        uint address = this->_address + HEADER_LENGTH;
+
+        for (uint i = 0; i < sizeof(T); )
+        {
+          uint run = 0;
+          bool zeros = EEPROMCompressed<T, Capacity, TChecksum>::nextRun(data, i, run);
+
+          returnValue = this->put(buffer, count, address, (byte)((zeros ? 0x80 : 0x00) | (run - 1)), verify) && returnValue;
+
+          for (uint j = 0; !zeros && j < run; j++)
+          {
+            returnValue = this->put(buffer, count, address, data[i + j], verify) && returnValue;
+          }
+
+          i += run;
+        }
+
+        returnValue = this->flush(buffer, count, address, verify) && returnValue;
+
+        //
+        // The length and checksum make the new image valid.
+        //
+        byte header[HEADER_LENGTH];
+        byte current[HEADER_LENGTH];
+        header[0] = length & 0xFF;
+        header[1] = (length >> 8) & 0xFF;
+        this->putChecksum(header + 2, TChecksum::get((byte*)data, sizeof(T)));
+        EEPROMUtil.readBlock(this->_address, current, HEADER_LENGTH);
+        returnValue = EEPROMUtil.writeChanges(this->_address, header, current, HEADER_LENGTH, verify) && returnValue;
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Checks whether the EEPROM variable has been initialized.
+     * @details The stored image is decoded to validate its checksum.
+     * @return True if the EEPROM variable has been initialized, false otherwise.
+     */
+    bool isInitialized() const
+    {
+      T value;
+      return this->read(value);
+    }
+
+    /**
+     * @brief Returns the number of EEPROM bytes reserved for the variable.
+     * @return The number of bytes used in the EEPROM as an unsigned integer.
+     */
+    uint length() const
+    {
+      return LENGTH;
+    }
+
+    /**
+     * @brief Gets the next EEPROM address after this variable.
+     * @return The next address in EEPROM as an unsigned integer.
+     */
+    uint nextAddress() const
+    {
+      return this->normalizeAddress(this->getAddress() + this->length());
+    }
+
+    /**
+     * @brief Unset the variable.
+     * @details Change the EEPROM values back to UNSET_VALUE as if the variable has never
+     * been written to the EEPROM.
+     */
+    void unset(byte unsetValue = UNSET_VALUE)
+    {
+      EEPROMUtil.fillBlock(this->_address, unsetValue, this->length());
+    }
+
+    /**
+     * @brief Gets the number of encoded bytes of the stored value.
+     * @return The stored length, or 0 if it is larger than Capacity.
+     */
+    uint compressedLength() const
+    {
+      byte header[2];
+      EEPROMUtil.readBlock(this->_address, header, 2);
+      uint returnValue = header[0] | ((uint)header[1] << 8);
+      return (returnValue <= Capacity) ? returnValue : 0;
+    }
+
+    /**
+     * @brief Gets the compression ratio achieved by the stored value.
+     * @details For example 4.0 means the encoded bytes are a quarter of sizeof(T).
+     * @return sizeof(T) divided by compressedLength(), or 0 if nothing is stored.
+     */
+    float ratio() const
+    {
+      uint length = this->compressedLength();
+      return length ? (float)sizeof(T) / length : 0.0;
+    }
+
+    /**
+     * @brief Computes the number of encoded bytes of a value without writing it.
+     * @details Use it to choose Capacity for the values that will be stored.
+     * @tparam value The value to encode.
+     * @return The number of encoded bytes.
+     */
+    static uint encodedLength(T const& value)
+    {
+      const byte* data = (const byte*)&value;
+      uint returnValue = 0;
+
+      for (uint i = 0; i < sizeof(T); )
+      {
+        uint run = 0;
+        bool zeros = EEPROMCompressed<T, Capacity, TChecksum>::nextRun(data, i, run);
+        returnValue += zeros ? 1 : 1 + run;
+        i += run;
+      }
+
+      return returnValue;
+    }
+
+  protected:
+    //
+    // These methods of EEPROMBase expect the uncompressed value and its
+    // checksum at the address of the variable, which is not the layout
+    // of the encoded image.
+    //
+    using EEPROMBase<T, TChecksum, EEPROMCompressed<T, Capacity, TChecksum>>::checksumAddress;
+    using EEPROMBase<T, TChecksum, EEPROMCompressed<T, Capacity, TChecksum>>::checksumByte;
+    using EEPROMBase<T, TChecksum, EEPROMCompressed<T, Capacity, TChecksum>>::checksum;
+    using EEPROMBase<T, TChecksum, EEPROMCompressed<T, Capacity, TChecksum>>::copyTo;
+    using EEPROMBase<T, TChecksum, EEPROMCompressed<T, Capacity, TChecksum>>::operator [];
+
+    /**
+     * @brief Finds the run of bytes described by the next token.
+     * @details A run of two or more zero bytes is encoded as one token. Any
+     * other bytes, including single zero bytes, are copied as literals until
+     * the next run of zero bytes.
+     * @param data The bytes of the value.
+     * @param index The index of the first byte of the run.
+     * @param run Receives the number of bytes in the run.
+     * @return True for a run of zero bytes, false for a run of literal bytes.
+     */
+    static bool nextRun(const byte* data, uint index, uint& run)
+    {
+      uint limit = min(sizeof(T) - index, (uint)EEPROM_COMPRESSED_RUN);
+      bool returnValue = EEPROMCompressed<T, Capacity, TChecksum>::isZeroRun(data, index);
+      run = 1;
+
+      while (run < limit && (returnValue ? data[index + run] == 0 : !EEPROMCompressed<T, Capacity, TChecksum>::isZeroRun(data, index + run)))
+      {
+        run++;
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Checks whether a run of at least two zero bytes starts at index.
+     */
+    static bool isZeroRun(const byte* data, uint index)
+    {
+      return (index + 1 < sizeof(T)) && data[index] == 0 && data[index + 1] == 0;
+    }
+
+    /**
+     * @brief Adds an encoded byte to the buffer and writes the buffer when it is full.
+     */
+    bool put(byte* buffer, uint& count, uint& address, byte value, bool verify) const
+    {
+      bool returnValue = true;
+      buffer[count++] = value;
+
+      if (count == EEPROM_DEVICE_BUFFER)
+      {
+        returnValue = this->flush(buffer, count, address, verify);
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Writes the bytes in the buffer that differ from the EEPROM.
+     */
+    bool flush(byte* buffer, uint& count, uint& address, bool verify) const
+    {
+      byte current[EEPROM_DEVICE_BUFFER];
+      EEPROMUtil.readBlock(address, current, count);
+      bool returnValue = EEPROMUtil.writeChanges(address, buffer, current, count, verify);
+
+      address += count;
+      count = 0;
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Decodes the stored image into the bytes of a value.
+     * @param length The number of encoded bytes.
+     * @param value Receives the decoded value.
+     * @return True if the encoded bytes produce exactly sizeof(T) bytes, false otherwise.
+     */
+    bool decode(uint length, T& value) const
+    {
+      byte* data = (byte*)&value;
+      byte buffer[EEPROM_DEVICE_BUFFER];
+      uint position = 0;
+      uint literals = 0;
+      bool returnValue = true;
+
+      for (uint i = 0; i < length && returnValue; i++)
+      {
+        if ((i % EEPROM_DEVICE_BUFFER) == 0)
+        {
+          EEPROMUtil.readBlock(this->_address + HEADER_LENGTH + i, buffer, min(length - i, (uint)EEPROM_DEVICE_BUFFER));
+        }
+
+        byte token = buffer[i % EEPROM_DEVICE_BUFFER];
+
+        if (literals > 0)
+        {
+          data[position++] = token;
+          literals--;
+        }
+        else
+        {
+          uint run = (token & 0x7F) + 1;
+          returnValue = (position + run <= sizeof(T));
+
+          if (!(token & 0x80))
+          {
+            literals = run;
+          }
+          else if (returnValue)
+          {
+            memset(data + position, 0, run);
+            position += run;
+          }
+        }
+      }
+
+      return returnValue && literals == 0 && position == sizeof(T);
+    }
+};
+#endif
@@ -0,0 +1,290 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_COUNTER_H
+#define EEPROM_COUNTER_H
+
+/**
+ * @file EEPROM-Counter.h
+ * @brief This file contains the EEPROMCounter<T, PoolBytes> definition.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+  #include <EEPROM.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+#include "EEPROM-Vars.h"
+#include "EEPROM-Util.h"
+#include "EEPROM-Operators.h"
+#include "EEPROM-WearLeveled.h"
+
+/**
+ * @class EEPROMCounter
+ * @brief An unsigned counter in EEPROM that is incremented by clearing
+ * one bit at a time.
+ * @details The counter is a high word, stored in an EEPROMPingPong<T>,
+ * and two pools of PoolBytes bytes. The low part of the count is the
+ * number of bits cleared in the pool selected by the parity of the high
+ * word, starting with bit 0 of the first byte, so an increment writes a
+ * single byte and only clears a bit. When the pool is exhausted the other
+ * pool is erased and the high word is incremented, which happens once
+ * every PoolBytes * 8 + 1 increments. A reset at any point during an
+ * increment leaves either the old or the new count. The position of the
+ * count is read once and cached. The increment, decrement and compound
+ * assignment operators work the same as on an EEPROMStorage variable.
+ *
+ *   EEPROMCounter<uint32_t> cycles(0);
+ *   cycles++;
+ *
+ * @tparam T The unsigned type of the count.
+ * @tparam PoolBytes The number of bytes in each pool (1 to 32).
+ */
+template <typename T = uint32_t, uint PoolBytes = 8>
+class EEPROMCounter : public EEPROMOperators<T, EEPROMCounter<T, PoolBytes>>
+{
+  static_assert((T)-1 > (T)0, "EEPROMCounter requires an unsigned type.");
+  static_assert(PoolBytes >= 1 && PoolBytes <= 32, "EEPROMCounter requires between 1 and 32 pool bytes.");
+
+  public:
+    static const uint PERIOD = (PoolBytes * 8) + 1;                                 ///< The number of counts per step of the high word.
+    static const uint LENGTH = EEPROMPingPong<T>::LENGTH + (2 * PoolBytes);           ///< The number of EEPROM bytes used.
+
+    /**
+     * @brief Initialize an instance of EEPROMCounter with the specified address.
+     * @param address The address (or index) of the counter within EEPROM.
+     */
+    EEPROMCounter(const uint address) : _high(address, 0)
+    {
+    }
+
+    /**
+     * @brief Implicitly converts the counter to its value.
+     * @return The current count as type T.
+     */
+    operator T() const
+    {
+      return this->get();
+    }
+
+    /**
+     * @brief Allows assignment of a value to the counter.
+     * @tparam value The new count.
+     * @return A reference to the counter.
+     */
+    EEPROMCounter<T, PoolBytes>& operator = (T const& value)
+    {
+      this->set(value);
+      return *this;
+    }
+
+    /**
+     * @brief Allows assignment of one counter to another.
+     * @details Accounts for EEPROMCounter<T> = EEPROMCounter<T>. The count
+     * of the other counter is written to this counter's EEPROM.
+     * @tparam item The counter whose count is stored.
+     * @return A reference to the counter.
+     */
+    EEPROMCounter<T, PoolBytes>& operator = (EEPROMCounter<T, PoolBytes> const& item)
+    {
+      this->set(item.get());
+      return *this;
+    }
+
+    /**
+     * @brief Get the count.
+     * @return The current count, or 0 if the counter has not been initialized.
+     */
+    T get() const
+    {
+      this->load();
+      return (this->_highValue * PERIOD) + this->_cleared;
+    }
+
+    /**
+     * @brief Set the count.
+     * @details Counting up within the active pool only clears bits. Moving to
+     * another high word writes the pool of the new high word before the high
+     * word itself. Setting a count whose high word differs by an even number
+     * rewrites the active pool in place, which is not safe against a reset.
+     * @tparam value The new count.
+     * @return The new count as type T.
+     */
+    T set(T const& value)
+    {
+      this->load();
+
+      T high = value / PERIOD;
+      uint cleared = value % PERIOD;
+
+      if (this->_initialized && high == this->_highValue && cleared >= this->_cleared)
+      {
+        this->clearBits(this->poolAddress(high), this->_cleared, cleared);
+      }
+      else
+      {
+        this->writePool(this->poolAddress(high), cleared);
+
+        if (!this->_initialized || high != this->_highValue)
+        {
+          this->_high.set(high);
+        }
+      }
+
+      this->_highValue = high;
+      this->_cleared = cleared;
+      this->_initialized = true;
+
+      return value;
+    }
+
+    /**
+     * @brief Checks whether the counter has been written.
+     * @return True if the high word is valid, false otherwise.
+     */
+    bool isInitialized() const
+    {
+      this->load();
+      return this->_initialized;
+    }
+
+    /**
+     * @brief Unset the counter.
+     * @details Change the EEPROM values back to UNSET_VALUE as if the counter has
+     * never been written. The count reads as 0.
+     */
+    void unset()
+    {
+      this->_high.unset();
+      EEPROMUtil.fillBlock(this->poolAddress(0), UNSET_VALUE, 2 * PoolBytes);
+      this->_loaded = false;
+    }
+
+    /**
+     * @brief Returns the number of EEPROM bytes used.
+     */
+    uint length() const
+    {
+      return LENGTH;
+    }
+
+    /**
+     * @brief Get the EEPROM address of the counter.
+     */
+    uint getAddress() const
+    {
+      return this->_high.getAddress();
+    }
+
+    /**
+     * @brief Gets the next EEPROM address after this counter.
+     */
+    uint nextAddress() const
+    {
+      return min(this->getAddress() + LENGTH, EEPROMUtil.length() - 1);
+    }
+
+  protected:
+    EEPROMPingPong<T> _high;                ///< The high word.
+    mutable T _highValue = 0;               ///< The cached high word.
+    mutable uint _cleared = 0;              ///< The cached number of bits cleared in the active pool.
+    mutable bool _initialized = false;      ///< True if the high word is valid.
+    mutable bool _loaded = false;           ///< True once the count has been read.
+
+    /**
+     * @brief Reads the high word and counts the cleared bits of the active pool.
+     */
+    void load() const
+    {
+      if (!this->_loaded)
+      {
+        this->_initialized = this->_high.isInitialized();
+        this->_highValue = this->_high.get();
+        this->_cleared = 0;
+
+        if (this->_initialized)
+        {
+          byte pool[PoolBytes];
+          EEPROMUtil.readBlock(this->poolAddress(this->_highValue), pool, PoolBytes);
+
+          for (uint i = 0; i < PoolBytes; i++)
+          {
+            for (byte bits = ~pool[i]; bits; bits &= bits - 1)
+            {
+              this->_cleared++;
+            }
+          }
+        }
+
+        this->_loaded = true;
+      }
+    }
+
+    /**
+     * @brief Gets the EEPROM address of the pool used by a high word.
+     */
+    uint poolAddress(T high) const
+    {
+      return this->getAddress() + EEPROMPingPong<T>::LENGTH + ((high & 1) * PoolBytes);
+    }
+
+    /**
+     * @brief Gets a byte of a pool with the given number of bits cleared.
+     */
+    static byte poolByte(uint index, uint cleared)
+    {
+      uint bits = (cleared > index * 8) ? min(cleared - (index * 8), 8U) : 0;
+      return (byte)(0xFF << bits);
+    }
+
+    /**
+     * @brief Clears the bits of a pool from one count to another.
+     * @details Only the bytes holding those bits are written.
+     */
+    void clearBits(uint address, uint from, uint to)
+    {
+      for (uint i = from / 8; i < PoolBytes && (i * 8) < to; i++)
+      {
+        EEPROMUtil.updateEEPROM(address + i, poolByte(i, to));
+      }
+    }
+
+    /**
+     * @brief Writes a whole pool with the given number of bits cleared.
+     */
+    void writePool(uint address, uint cleared)
+    {
+      byte pool[PoolBytes];
+
+      for (uint i = 0; i < PoolBytes; i++)
+      {
+        pool[i] = poolByte(i, cleared);
+      }
+
+      EEPROMUtil.updateBlock(address, pool, PoolBytes);
+    }
+};
+#endif
@@ -22,6 +22,15 @@
 
 #include "EEPROM-Debug.h"
 
+/******************************************************************************
+   GLOBAL VARIABLES
+ ******************************************************************************/
+
+#if defined(EEPROM_HOST)
+Stream Serial;
+EEPROMHostClass EEPROM;
+#endif
+
 /******************************************************************************
    CONSTANTS
  ******************************************************************************/
@@ -131,8 +140,11 @@ void EEPROMDebug::print(int const debug_level, const __FlashStringHelper * fmt,
  ******************************************************************************/
 
 void EEPROMDebug::vPrint(char const * fmt, va_list args) {
-  // calculate required buffer length
-  int msg_buf_size = vsnprintf(nullptr, 0, fmt, args) + 1; // add one for null terminator
+  // calculate required buffer length (on a copy, args is used again below)
+  va_list args_copy;
+  va_copy(args_copy, args);
+  int msg_buf_size = vsnprintf(nullptr, 0, fmt, args_copy) + 1; // add one for null terminator
+  va_end(args_copy);
 #if defined(ARDUINO) && ARDUINO >= 100
   #if __STDC_NO_VLA__ == 1
     // in the rare case where VLA is not allowed by compiler, fall back on heap-allocated memory
@@ -140,7 +152,7 @@ void EEPROMDebug::vPrint(char const * fmt, va_list args) {
   #else
     char msg_buf[msg_buf_size];
   #endif
-#elif defined(PARTICLE)
+#else
   char msg_buf[msg_buf_size];
 #endif
 
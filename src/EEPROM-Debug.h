@@ -27,6 +27,8 @@
   #include <stdarg.h>
 #elif defined(PARTICLE)
   #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
 #endif
 
 /******************************************************************************
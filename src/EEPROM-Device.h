@@ -0,0 +1,234 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_DEVICE_H
+#define EEPROM_DEVICE_H
+
+/**
+ * @file EEPROM-Device.h
+ * @brief This file contains the EEPROMDevice definition.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+#include "EEPROM-Vars.h"
+
+/**
+ * @class EEPROMDevice
+ * @brief Interface of an EEPROM other than the internal EEPROM.
+ * @details Pass an instance to EEPROMUtil.setDevice() to route every
+ * read and write of the library to the device. EEPROMUtil compares the
+ * stored bytes first and only calls write() for the changed bytes of
+ * each page, so that a device with a page buffer (such as an I2C or SPI
+ * EEPROM) writes a whole page in one write cycle.
+ */
+class EEPROMDevice
+{
+  public:
+    /**
+     * @brief Gets the number of bytes in the device.
+     */
+    virtual uint length() = 0;
+
+    /**
+     * @brief Gets the number of bytes that can be written in one write cycle.
+     * @details A call to write() never crosses a boundary of this size.
+     */
+    virtual uint pageSize()
+    {
+      return 1;
+    }
+
+    /**
+     * @brief Reads one byte.
+     * @param address The address of the byte.
+     * @return The byte read.
+     */
+    virtual byte read(uint address) = 0;
+
+    /**
+     * @brief Reads a block of bytes.
+     * @details Devices that support sequential reads should override this method.
+     * @param address The address of the first byte.
+     * @param data Receives the bytes read.
+     * @param length The number of bytes to read.
+     */
+    virtual void read(uint address, byte* data, uint length)
+    {
+      for (uint i = 0; i < length; i++)
+      {
+        data[i] = this->read(address + i);
+      }
+    }
+
+    /**
+     * @brief Writes a block of bytes within a single page and waits
+     * until the write cycle has completed.
+     * @param address The address of the first byte.
+     * @param data The bytes to write.
+     * @param length The number of bytes to write.
+     * @return False if the device reported that the write failed, true otherwise.
+     */
+    virtual bool write(uint address, const byte* data, uint length) = 0;
+};
+
+//
+// A simulated I2C EEPROM for testing on the host.
+//
+#if defined(EEPROM_HOST)
+/**
+ * @class EEPROMHost24LC
+ * @brief Simulates a 24LCxx I2C EEPROM.
+ * @details A write within a page takes one write cycle regardless of the
+ * number of bytes, and bytes past the end of a page wrap around to the
+ * start of the same page as they do on the real device. The time spent
+ * on the bus and in write cycles is accumulated in elapsed() using a
+ * 400 kHz bus (9 bits per byte) and the write cycle time of the device.
+ * @tparam Length The number of bytes (32768 for a 24LC256).
+ * @tparam PageSize The page size (64 for a 24LC256).
+ * @tparam CycleMicros The write cycle time in microseconds.
+ */
+template <uint Length, uint PageSize, uint CycleMicros = 5000>
+class EEPROMHost24LC : public EEPROMDevice
+{
+  public:
+    static const uint BYTE_MICROS = 23;   ///< The time to transfer one byte at 400 kHz, rounded up.
+    static const uint HEADER_BYTES = 3;   ///< The control byte and two address bytes of each transfer.
+    static const uint32_t NO_FAILURE = 0xFFFFFFFF; ///< Passed to failAfter() to restore power.
+
+    EEPROMHost24LC()
+    {
+      memset(this->_data, UNSET_VALUE, sizeof(this->_data));
+      this->resetCounters();
+    }
+
+    uint length()
+    {
+      return Length;
+    }
+
+    uint pageSize()
+    {
+      return PageSize;
+    }
+
+    byte read(uint address)
+    {
+      byte returnValue = UNSET_VALUE;
+      this->read(address, &returnValue, 1);
+      return returnValue;
+    }
+
+    void read(uint address, byte* data, uint length)
+    {
+      this->_readTransfers++;
+      this->_elapsed += (HEADER_BYTES + length) * BYTE_MICROS;
+
+      for (uint i = 0; i < length; i++)
+      {
+        data[i] = this->_data[(address + i) % Length];
+      }
+    }
+
+    bool write(uint address, const byte* data, uint length)
+    {
+      //
+      // Simulate a power failure by dropping the write.
+      //
+      if (this->_writesUntilFailure == 0)
+      {
+        return true;
+      }
+      else if (this->_writesUntilFailure != NO_FAILURE)
+      {
+        this->_writesUntilFailure--;
+      }
+
+      this->_pageWrites++;
+      this->_bytesWritten += length;
+      this->_elapsed += ((HEADER_BYTES + length) * BYTE_MICROS) + CycleMicros;
+
+      //
+      // Bytes past the end of the page wrap to its start.
+      //
+      uint page = (address % Length) - ((address % Length) % PageSize);
+
+      for (uint i = 0; i < length; i++)
+      {
+        this->_data[page + ((address + i) % PageSize)] = data[i];
+      }
+
+      return true;
+    }
+
+    /**
+     * @brief Reset the counters and the elapsed time to zero.
+     */
+    void resetCounters()
+    {
+      this->_readTransfers = 0;
+      this->_pageWrites = 0;
+      this->_bytesWritten = 0;
+      this->_elapsed = 0;
+    }
+
+    /**
+     * @brief Simulate a power failure after the given number of page writes.
+     * @details Every page write after them is acknowledged but lost. Pass
+     * NO_FAILURE to restore power.
+     * @param writes The number of page writes that still succeed.
+     */
+    void failAfter(uint32_t writes)
+    {
+      this->_writesUntilFailure = writes;
+    }
+
+    uint32_t readTransfers() const { return this->_readTransfers; }
+    uint32_t pageWrites() const { return this->_pageWrites; }
+    uint32_t bytesWritten() const { return this->_bytesWritten; }
+
+    /**
+     * @brief Gets the simulated time spent on the bus and in write cycles.
+     */
+    uint32_t elapsed() const { return this->_elapsed; }
+
+    /**
+     * @brief Direct access to the simulated memory without counting.
+     */
+    byte* data() { return this->_data; }
+
+  protected:
+    byte _data[Length];
+    uint32_t _readTransfers;
+    uint32_t _pageWrites;
+    uint32_t _bytesWritten;
+    uint32_t _elapsed;
+    uint32_t _writesUntilFailure = NO_FAILURE;
+};
+#endif
+#endif
@@ -44,6 +44,8 @@
   #include <EEPROM.h>
 #elif defined(PARTICLE)
   #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
 #endif
 
 #include "EEPROM-Base.h"
@@ -135,7 +137,7 @@ class EEPROMDisplayClass
       //
       // Get every byte from EEPROM
       //
-      uint maxLines = EEPROM.length() / WIDTH;
+      uint maxLines = EEPROMUtil.length() / WIDTH;
       uint i = 0;
 
       for (uint row = 0; row < maxLines; row++)
@@ -146,7 +148,7 @@ class EEPROMDisplayClass
         for(uint j = 0; j < WIDTH; j++)
         {
           char b[3];
-          sprintf(b, "%.2X ", (byte)EEPROM[i++]);
+          sprintf(b, "%.2X ", EEPROMUtil.readEEPROM(i++));
           buffer[(j * 3) + 7] = b[0];
           buffer[(j * 3) + 8] = b[1];
           buffer[(j * 3) + 9] = b[2];
@@ -159,13 +161,13 @@ class EEPROMDisplayClass
     /**
      * @brief Display the properties of a variable.
      * @param name The name of the variable.
-     * @tparam value The value of the variable.
+     * @tparam value The variable, such as an EEPROMStorage<T> or EEPROMCache<T>.
      */
-    template<typename T>
-    void displayVariable(const char* name, EEPROMBase<T> value)
+    template<typename TVariable>
+    void displayVariable(const char* name, const TVariable& value)
     {
-      DEBUG_INFO("%s: Variable Size: %2d, Memory Length = %2d, Start Address = %2d, Checksum Address = %2d, Checksum Value = %2d, Initialized = %s",
-                  name, value.size(), value.length(), value.getAddress(), value.checksumAddress(), value.checksumByte(), value.isInitialized() ? "Yes" : "No");
+      DEBUG_INFO("%s: Variable Size: %2d, Memory Length = %2d, Start Address = %2d, Checksum Address = %2d, Checksum Value = %2lu, Initialized = %s",
+                  name, value.size(), value.length(), value.getAddress(), value.checksumAddress(), (unsigned long)value.checksumByte(), value.isInitialized() ? "Yes" : "No");
     }
 
     /**
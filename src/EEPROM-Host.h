@@ -0,0 +1,449 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_HOST_H
+#define EEPROM_HOST_H
+
+/**
+ * @file EEPROM-Host.h
+ * @brief This file contains the EEPROMHostClass definition.
+ * @details Provides the small subset of the Arduino API used by this
+ * library and a simulated EEPROM so that the library, the tests and the
+ * benchmarks can be compiled with GNU C++ on a POSIX host. This file is
+ * only used when neither ARDUINO nor PARTICLE is defined.
+ */
+
+#if !(defined(ARDUINO) && ARDUINO >= 100) && !defined(PARTICLE)
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <type_traits>
+
+/**
+ * @brief Defined when the library is compiled against the host backend.
+ */
+#define EEPROM_HOST
+
+/**
+ * @brief The number of bytes in the simulated EEPROM.
+ */
+#ifndef EEPROM_HOST_SIZE
+  #define EEPROM_HOST_SIZE 4096
+#endif
+
+//
+// Arduino types.
+//
+typedef uint8_t byte;
+typedef unsigned int uint;
+
+//
+// Arduino helper functions.
+//
+template <typename A, typename B>
+inline typename std::common_type<A, B>::type min(A a, B b)
+{
+  return a < b ? a : b;
+}
+
+template <typename A, typename B>
+inline typename std::common_type<A, B>::type max(A a, B b)
+{
+  return a > b ? a : b;
+}
+
+inline unsigned long micros()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long)(ts.tv_sec * 1000000UL + ts.tv_nsec / 1000UL);
+}
+
+inline unsigned long millis()
+{
+  return micros() / 1000UL;
+}
+
+inline void delay(unsigned long ms)
+{
+  usleep(ms * 1000UL);
+}
+
+inline void randomSeed(unsigned long seed)
+{
+  srandom(seed);
+}
+
+inline long random(long howBig)
+{
+  return howBig == 0 ? 0 : ::random() % howBig;
+}
+
+inline long random(long howSmall, long howBig)
+{
+  return howSmall >= howBig ? howSmall : howSmall + random(howBig - howSmall);
+}
+
+inline int analogRead(uint8_t pin)
+{
+  return (int)time(NULL) + pin;
+}
+
+inline char* dtostrf(double value, signed char width, unsigned char precision, char* buffer)
+{
+  sprintf(buffer, "%*.*f", width, precision, value);
+  return buffer;
+}
+
+//
+// Flash strings are ordinary strings on the host.
+//
+class __FlashStringHelper;
+#define F(text) (reinterpret_cast<const __FlashStringHelper*>(text))
+#define PROGMEM
+#define pgm_read_byte(address) (*(const uint8_t*)(address))
+#define pgm_read_word(address) (*(const uint16_t*)(address))
+#define pgm_read_dword(address) (*(const uint32_t*)(address))
+#define memcpy_P memcpy
+
+/**
+ * @class String
+ * @brief Minimal string wrapper used by EEPROMDebug.
+ */
+class String
+{
+  public:
+    String(const char* value) : _value(value) {}
+    String(const __FlashStringHelper* value) : _value(reinterpret_cast<const char*>(value)) {}
+    const char* c_str() const { return this->_value; }
+
+  private:
+    const char* _value;
+};
+
+/**
+ * @class Stream
+ * @brief Minimal output stream that writes to stdout.
+ */
+class Stream
+{
+  public:
+    void begin(unsigned long) {}
+    operator bool() const { return true; }
+    size_t print(const char* value) { return fputs(value, stdout) < 0 ? 0 : strlen(value); }
+    size_t println(const char* value) { return this->print(value) + this->print("\r\n"); }
+};
+
+/**
+ * @brief The Stream named Serial used by the sketches, defined once in EEPROM-Debug.cpp.
+ */
+extern Stream Serial;
+
+/**
+ * @class EEPROMHostRef
+ * @brief Proxy returned by EEPROMHostClass::operator[].
+ */
+template <typename TDevice>
+class EEPROMHostRef
+{
+  public:
+    EEPROMHostRef(TDevice& device, int address) : _device(device), _address(address) {}
+    operator uint8_t() const { return this->_device.read(this->_address); }
+    EEPROMHostRef& operator = (uint8_t value) { this->_device.write(this->_address, value); return *this; }
+
+  private:
+    TDevice& _device;
+    int _address;
+};
+
+/**
+ * @class EEPROMHostClass
+ * @brief Simulated EEPROM with per-address access counters.
+ * @details Exposes the same read(), write(), update(), get(), put(),
+ * length() and operator[] surface as the Arduino EEPROM library. The
+ * memory is a RAM array by default or a memory mapped file after calling
+ * begin(path). Every read, write and erase is counted per address so
+ * that the number of EEPROM accesses made by the library can be measured.
+ * A write is counted as an erase when it changes any bit from 0 to 1.
+ */
+class EEPROMHostClass
+{
+  public:
+    EEPROMHostClass()
+    {
+      memset(this->_ram, UNSET_BYTE, sizeof(this->_ram));
+      this->_data = this->_ram;
+      this->_writesUntilFailure = NO_FAILURE;
+      this->resetCounters();
+    }
+
+    ~EEPROMHostClass()
+    {
+      this->end();
+    }
+
+    /**
+     * @brief Back the simulated EEPROM with a memory mapped file.
+     * @details The file is created and filled with 0xFF if it does not exist.
+     * @param path The path of the file.
+     * @return True if the file was mapped, false otherwise.
+     */
+    bool begin(const char* path)
+    {
+      bool returnValue = false;
+      this->end();
+
+      int fd = open(path, O_RDWR | O_CREAT, 0644);
+
+      if (fd >= 0)
+      {
+        off_t size = lseek(fd, 0, SEEK_END);
+
+        if (size < (off_t)EEPROM_HOST_SIZE)
+        {
+          byte erased[EEPROM_HOST_SIZE];
+          memset(erased, UNSET_BYTE, sizeof(erased));
+          ssize_t written = pwrite(fd, erased + size, EEPROM_HOST_SIZE - size, size);
+          (void)written;
+        }
+
+        void* map = mmap(NULL, EEPROM_HOST_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+
+        if (map != MAP_FAILED)
+        {
+          this->_data = (byte*)map;
+          returnValue = true;
+        }
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Unmap the backing file (if any) and return to the RAM array.
+     */
+    void end()
+    {
+      if (this->_data != this->_ram)
+      {
+        munmap(this->_data, EEPROM_HOST_SIZE);
+        this->_data = this->_ram;
+      }
+    }
+
+    uint8_t read(int address)
+    {
+      uint8_t returnValue = UNSET_BYTE;
+
+      if (address >= 0 && address < EEPROM_HOST_SIZE)
+      {
+        this->_reads[address]++;
+        this->_totalReads++;
+        returnValue = this->_data[address];
+      }
+
+      return returnValue;
+    }
+
+    void write(int address, uint8_t value)
+    {
+      if (address < 0 || address >= EEPROM_HOST_SIZE)
+      {
+        return;
+      }
+
+      //
+      // Simulate a power failure by dropping the write.
+      //
+      if (this->_writesUntilFailure == 0)
+      {
+        return;
+      }
+      else if (this->_writesUntilFailure != NO_FAILURE)
+      {
+        this->_writesUntilFailure--;
+      }
+
+      uint8_t current = this->_data[address];
+      this->_writes[address]++;
+      this->_totalWrites++;
+
+      if ((~current & value) != 0)
+      {
+        this->_erases[address]++;
+        this->_totalErases++;
+      }
+
+      if (current != value)
+      {
+        this->_changes[address]++;
+        this->_totalChanges++;
+      }
+
+      this->_data[address] = value;
+    }
+
+    void update(int address, uint8_t value)
+    {
+      if (this->read(address) != value)
+      {
+        this->write(address, value);
+      }
+    }
+
+    template <typename T>
+    T& get(int address, T& value)
+    {
+      byte* data = (byte*)&value;
+
+      for (uint i = 0; i < sizeof(T); i++)
+      {
+        data[i] = this->read(address + i);
+      }
+
+      return value;
+    }
+
+    template <typename T>
+    const T& put(int address, const T& value)
+    {
+      const byte* data = (const byte*)&value;
+
+      for (uint i = 0; i < sizeof(T); i++)
+      {
+        this->update(address + i, data[i]);
+      }
+
+      return value;
+    }
+
+    uint16_t length() const
+    {
+      return EEPROM_HOST_SIZE;
+    }
+
+    EEPROMHostRef<EEPROMHostClass> operator[] (int address)
+    {
+      return EEPROMHostRef<EEPROMHostClass>(*this, address);
+    }
+
+    /**
+     * @brief Reset all access counters to zero.
+     */
+    void resetCounters()
+    {
+      memset(this->_reads, 0, sizeof(this->_reads));
+      memset(this->_writes, 0, sizeof(this->_writes));
+      memset(this->_erases, 0, sizeof(this->_erases));
+      memset(this->_changes, 0, sizeof(this->_changes));
+      this->_totalReads = 0;
+      this->_totalWrites = 0;
+      this->_totalErases = 0;
+      this->_totalChanges = 0;
+    }
+
+    /**
+     * @brief Simulate a power failure after the given number of writes.
+     * @details The given number of writes are made and every write
+     * after them is lost, as if the device lost power. Pass NO_FAILURE
+     * to restore power.
+     * @param writes The number of writes that still succeed.
+     */
+    void failAfter(uint32_t writes)
+    {
+      this->_writesUntilFailure = writes;
+    }
+
+    /**
+     * @brief Checks whether writes are being lost after a call to failAfter().
+     */
+    bool failed() const
+    {
+      return this->_writesUntilFailure == 0;
+    }
+
+    /**
+     * @brief Direct access to the simulated memory without counting.
+     */
+    byte* data()
+    {
+      return this->_data;
+    }
+
+    uint32_t readCount(uint address) const { return this->_reads[address]; }
+    uint32_t writeCount(uint address) const { return this->_writes[address]; }
+    uint32_t eraseCount(uint address) const { return this->_erases[address]; }
+    uint32_t changeCount(uint address) const { return this->_changes[address]; }
+
+    uint32_t totalReads() const { return this->_totalReads; }
+    uint32_t totalWrites() const { return this->_totalWrites; }
+    uint32_t totalErases() const { return this->_totalErases; }
+    uint32_t totalChanges() const { return this->_totalChanges; }
+
+    /**
+     * @brief Gets the highest write count of any single address.
+     */
+    uint32_t maxWriteCount() const
+    {
+      uint32_t returnValue = 0;
+
+      for (uint i = 0; i < EEPROM_HOST_SIZE; i++)
+      {
+        returnValue = max(returnValue, this->_writes[i]);
+      }
+
+      return returnValue;
+    }
+
+    static const uint32_t NO_FAILURE = 0xFFFFFFFF; ///< Passed to failAfter() to restore power.
+
+  protected:
+    static const byte UNSET_BYTE = 0xFF;
+
+    byte* _data;
+    byte _ram[EEPROM_HOST_SIZE];
+    uint32_t _reads[EEPROM_HOST_SIZE];
+    uint32_t _writes[EEPROM_HOST_SIZE];
+    uint32_t _erases[EEPROM_HOST_SIZE];
+    uint32_t _changes[EEPROM_HOST_SIZE];
+    uint32_t _totalReads;
+    uint32_t _totalWrites;
+    uint32_t _totalErases;
+    uint32_t _totalChanges;
+    uint32_t _writesUntilFailure;
+};
+
+/**
+ * @brief The EEPROMHostClass named EEPROM used by the library and the
+ * sketches, defined once in EEPROM-Debug.cpp so that every file of the
+ * program shares the same simulated memory and counters.
+ */
+extern EEPROMHostClass EEPROM;
+
+#endif
+#endif
@@ -0,0 +1,593 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_KEY_VALUE_H
+#define EEPROM_KEY_VALUE_H
+
+/**
+ * @file EEPROM-KeyValue.h
+ * @brief This file contains the EEPROMKeyValue<Slots, ValueSize> definition.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+  #include <EEPROM.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+#include "EEPROM-Vars.h"
+#include "EEPROM-Util.h"
+#include "EEPROM-Checksum.h"
+#include "EEPROM-CRC.h"
+
+/**
+ * @class EEPROMKeyValue
+ * @brief A hash table of values of up to ValueSize bytes stored in EEPROM
+ * under numeric keys.
+ * @details The table is a region of Slots entries. Each entry holds the key
+ * (least significant byte first), the size of the value, the value padded to
+ * ValueSize bytes and a checksum covering the key, size and value. A size of
+ * 0xFF marks an empty entry and a size of 0 marks a removed entry (tombstone).
+ * A key is stored in the first free entry from its hashed slot onwards (linear
+ * probing).
+ *
+ * The first time the table is used (or by rebuild()) the entry headers are read
+ * once to build two bitmaps in RAM: one bit per entry that is in use and a
+ * filter of FilterBits bits with a bit set for each stored key. Looking up a key
+ * whose filter bit is clear reads nothing from EEPROM, and a lookup stops at the
+ * first entry that is not in use without reading it. Removing a key writes only
+ * the size byte. When more than a quarter of the entries are tombstones, put()
+ * calls compact() which empties them and moves entries back towards their slot.
+ *
+ *   EEPROMKeyValue<64, 4> settings(0);
+ *   settings.put<uint16_t>(PARAM_RATE, 250);
+ *   uint16_t rate = settings.get<uint16_t>(PARAM_RATE, 100);
+ *
+ * @tparam Slots The number of entries (2 to 4096).
+ * @tparam ValueSize The largest value in bytes (1 to 254).
+ * @tparam TKey The type of the keys, uint16_t (default) or uint32_t.
+ * @tparam FilterBits The number of bits in the RAM filter.
+ * @tparam TChecksum The checksum policy, Checksum<TKey> (default) or one
+ * of the CRC policies in EEPROM-CRC.h.
+ */
+template <uint Slots, uint ValueSize = 4, typename TKey = uint16_t, uint FilterBits = 256, typename TChecksum = Checksum<TKey>>
+class EEPROMKeyValue
+{
+  static_assert(Slots >= 2 && Slots <= 4096, "EEPROMKeyValue requires between 2 and 4096 slots.");
+  static_assert(ValueSize >= 1 && ValueSize <= 254, "EEPROMKeyValue requires a value size between 1 and 254 bytes.");
+  static_assert(FilterBits >= 8, "EEPROMKeyValue requires a filter of at least 8 bits.");
+
+  public:
+    typedef TKey key_type;                                ///< The type of the keys.
+    typedef typename TChecksum::checksum_t checksum_t;    ///< The type of the stored checksum.
+
+    static const uint ENTRY_LENGTH = sizeof(TKey) + 1 + ValueSize + sizeof(checksum_t);   ///< The number of bytes in one entry.
+    static const uint LENGTH = Slots * ENTRY_LENGTH;                                      ///< The number of EEPROM bytes used by all entries.
+
+    /**
+     * @brief Initialize an instance of EEPROMKeyValue with the specified address.
+     * @param address The address (or index) of the first entry within EEPROM.
+     */
+    EEPROMKeyValue(const uint address)
+    {
+      this->_address = min(address, EEPROMUtil.length() - 1);
+    }
+
+    /**
+     * @brief Reads the entry headers to rebuild the bitmaps in RAM.
+     * @details Called automatically the first time the table is used. Call it
+     * again if the EEPROM was changed by something other than this instance.
+     */
+    void rebuild() const
+    {
+      memset(this->_used, 0, sizeof(this->_used));
+      memset(this->_filter, 0, sizeof(this->_filter));
+      this->_count = 0;
+      this->_tombstones = 0;
+      this->_built = true;
+
+      for (uint slot = 0; slot < Slots; slot++)
+      {
+        TKey key;
+        byte size = this->readHeader(slot, key);
+
+        if (size != EMPTY)
+        {
+          this->mark(this->_used, slot, true);
+
+          if (size == TOMBSTONE)
+          {
+            this->_tombstones++;
+          }
+          else
+          {
+            this->mark(this->_filter, this->filterBit(key), true);
+            this->_count++;
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief Reads the value stored under a key.
+     * @param key The key.
+     * @param value Receives the value.
+     * @return True if the key is stored with a value of type T and a valid
+     * checksum, false otherwise.
+     */
+    template <typename T>
+    bool read(TKey key, T& value) const
+    {
+      static_assert(sizeof(T) <= ValueSize, "The value is larger than the ValueSize of the EEPROMKeyValue.");
+
+      bool returnValue = false;
+      byte size = 0;
+      uint slot = this->find(key, size);
+
+      if (slot != Slots && size == sizeof(T))
+      {
+        //
+        // Rebuild the header in RAM and read the value and checksum.
+        //
+        byte entry[sizeof(TKey) + 1 + sizeof(T)];
+        this->putKey(entry, key);
+        entry[sizeof(TKey)] = size;
+
+        uint address = this->entryAddress(slot);
+        EEPROMUtil.readBlock(address + sizeof(TKey) + 1, entry + sizeof(TKey) + 1, sizeof(T));
+
+        if (TChecksum::get(entry, sizeof(entry)) == this->readChecksum(address + ENTRY_LENGTH - sizeof(checksum_t)))
+        {
+          memcpy(&value, entry + sizeof(TKey) + 1, sizeof(T));
+          returnValue = true;
+        }
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Gets the value stored under a key.
+     * @param key The key.
+     * @param defaultValue Returned when the key is not stored.
+     * @return The stored value or the default value as type T.
+     */
+    template <typename T>
+    T get(TKey key, T const& defaultValue = T()) const
+    {
+      T returnValue;
+
+      if (!this->read(key, returnValue))
+      {
+        returnValue = defaultValue;
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Stores a value under a key.
+     * @details A stored key is updated in place, writing only the bytes that
+     * changed. A new key uses the first removed or empty entry from its slot.
+     * @param key The key.
+     * @param value The value.
+     * @return True if the value was stored, false if the table is full.
+     */
+    template <typename T>
+    bool put(TKey key, T const& value)
+    {
+      static_assert(sizeof(T) <= ValueSize, "The value is larger than the ValueSize of the EEPROMKeyValue.");
+
+      this->ensureBuilt();
+
+      if (this->_tombstones > (Slots / 4))
+      {
+        this->compact();
+      }
+
+      uint free = Slots;
+      byte size = 0;
+      uint slot = this->locate(key, size, free);
+
+      if (slot == Slots && free == Slots && this->_tombstones > 0)
+      {
+        this->compact();
+        slot = this->locate(key, size, free);
+      }
+
+      bool returnValue = (slot != Slots || free != Slots);
+
+      if (returnValue)
+      {
+        if (slot == Slots)
+        {
+          slot = free;
+
+          if (this->isMarked(this->_used, slot))
+          {
+            this->_tombstones--;
+          }
+
+          this->mark(this->_used, slot, true);
+          this->mark(this->_filter, this->filterBit(key), true);
+          this->_count++;
+        }
+
+        byte entry[ENTRY_LENGTH];
+        memset(entry, UNSET_VALUE, ENTRY_LENGTH);
+        this->putKey(entry, key);
+        entry[sizeof(TKey)] = sizeof(T);
+        memcpy(entry + sizeof(TKey) + 1, &value, sizeof(T));
+        this->putChecksum(entry + ENTRY_LENGTH - sizeof(checksum_t), TChecksum::get(entry, sizeof(TKey) + 1 + sizeof(T)));
+
+        EEPROMUtil.updateBlock(this->entryAddress(slot), entry, ENTRY_LENGTH);
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Removes a key.
+     * @details The entry is marked as removed by writing its size byte.
+     * @param key The key.
+     * @return True if the key was stored, false otherwise.
+     */
+    bool remove(TKey key)
+    {
+      bool returnValue = false;
+      byte size = 0;
+
+      //
+      // Remove every copy; a reset during compact() can leave two.
+      //
+      for (uint slot = this->find(key, size); slot != Slots; slot = this->find(key, size))
+      {
+        EEPROMUtil.updateEEPROM(this->entryAddress(slot) + sizeof(TKey), TOMBSTONE);
+        this->_count--;
+        this->_tombstones++;
+        returnValue = true;
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Checks whether a key is stored.
+     * @param key The key.
+     * @return True if the key is stored, false otherwise.
+     */
+    bool contains(TKey key) const
+    {
+      byte size = 0;
+      return this->find(key, size) != Slots;
+    }
+
+    /**
+     * @brief Empties the removed entries and moves entries closer to their slot.
+     * @details Each entry that can move is written to its new entry before its old
+     * entry is emptied. A reset in between leaves two copies of the key; the first
+     * one is found by read() and put() and remove() removes both.
+     */
+    void compact()
+    {
+      this->ensureBuilt();
+
+      for (uint slot = 0; slot < Slots; slot++)
+      {
+        TKey key;
+
+        if (this->isMarked(this->_used, slot) && this->readHeader(slot, key) == TOMBSTONE)
+        {
+          EEPROMUtil.fillBlock(this->entryAddress(slot), UNSET_VALUE, ENTRY_LENGTH);
+          this->mark(this->_used, slot, false);
+        }
+      }
+
+      //
+      // An entry must be reachable from its slot without
+      // crossing an empty entry.
+      //
+      bool moved = true;
+
+      while (moved)
+      {
+        moved = false;
+
+        for (uint slot = 0; slot < Slots; slot++)
+        {
+          TKey key;
+
+          if (this->isMarked(this->_used, slot))
+          {
+            this->readHeader(slot, key);
+
+            for (uint target = this->home(key); target != slot; target = (target + 1) % Slots)
+            {
+              if (!this->isMarked(this->_used, target))
+              {
+                byte entry[ENTRY_LENGTH];
+                EEPROMUtil.readBlock(this->entryAddress(slot), entry, ENTRY_LENGTH);
+                EEPROMUtil.updateBlock(this->entryAddress(target), entry, ENTRY_LENGTH);
+                EEPROMUtil.fillBlock(this->entryAddress(slot), UNSET_VALUE, ENTRY_LENGTH);
+                this->mark(this->_used, target, true);
+                this->mark(this->_used, slot, false);
+                moved = true;
+                break;
+              }
+            }
+          }
+        }
+      }
+
+      this->rebuild();
+    }
+
+    /**
+     * @brief Removes every key.
+     */
+    void clear()
+    {
+      EEPROMUtil.fillBlock(this->_address, UNSET_VALUE, LENGTH);
+      this->rebuild();
+    }
+
+    /**
+     * @brief Gets the number of keys stored.
+     */
+    uint count() const
+    {
+      this->ensureBuilt();
+      return this->_count;
+    }
+
+    /**
+     * @brief Gets the number of removed entries that have not been compacted.
+     */
+    uint tombstones() const
+    {
+      this->ensureBuilt();
+      return this->_tombstones;
+    }
+
+    /**
+     * @brief Gets the number of entries.
+     */
+    uint capacity() const
+    {
+      return Slots;
+    }
+
+    /**
+     * @brief Returns the number of EEPROM bytes used by all entries.
+     */
+    uint length() const
+    {
+      return LENGTH;
+    }
+
+    /**
+     * @brief Get the EEPROM address of the first entry.
+     */
+    uint getAddress() const
+    {
+      return this->_address;
+    }
+
+    /**
+     * @brief Gets the next EEPROM address after this table.
+     */
+    uint nextAddress() const
+    {
+      return min(this->_address + LENGTH, EEPROMUtil.length() - 1);
+    }
+
+    static const byte EMPTY = 0xFF;      ///< The size byte of an entry that has never been used.
+    static const byte TOMBSTONE = 0x00;  ///< The size byte of an entry whose key was removed.
+
+  protected:
+    uint _address;
+    mutable byte _used[(Slots + 7) / 8];          ///< One bit per entry that is not empty.
+    mutable byte _filter[(FilterBits + 7) / 8];   ///< One bit per filter position of a stored key.
+    mutable uint _count = 0;                      ///< The number of keys stored.
+    mutable uint _tombstones = 0;                 ///< The number of removed entries.
+    mutable bool _built = false;                  ///< True once the bitmaps have been built.
+
+    /**
+     * @brief Builds the bitmaps if they have not been built.
+     */
+    void ensureBuilt() const
+    {
+      if (!this->_built)
+      {
+        this->rebuild();
+      }
+    }
+
+    /**
+     * @brief Finds the entry holding a key, reading nothing if its filter bit is clear.
+     * @param key The key.
+     * @param size Receives the size byte of the entry.
+     * @return The slot of the entry or Slots if the key is not stored.
+     */
+    uint find(TKey key, byte& size) const
+    {
+      uint free = Slots;
+      uint returnValue = Slots;
+
+      this->ensureBuilt();
+
+      if (this->isMarked(this->_filter, this->filterBit(key)))
+      {
+        returnValue = this->locate(key, size, free);
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Walks the entries from the slot of a key to the first empty entry.
+     * @param key The key.
+     * @param size Receives the size byte of the entry holding the key.
+     * @param free Receives the first removed or empty entry, or Slots if there is none.
+     * @return The slot of the entry or Slots if the key is not stored.
+     */
+    uint locate(TKey key, byte& size, uint& free) const
+    {
+      uint returnValue = Slots;
+      uint slot = this->home(key);
+      free = Slots;
+
+      for (uint i = 0; i < Slots && returnValue == Slots; i++)
+      {
+        if (!this->isMarked(this->_used, slot))
+        {
+          free = (free == Slots) ? slot : free;
+          break;
+        }
+
+        TKey stored;
+        byte storedSize = this->readHeader(slot, stored);
+
+        if (storedSize == TOMBSTONE)
+        {
+          free = (free == Slots) ? slot : free;
+        }
+        else if (stored == key)
+        {
+          size = storedSize;
+          returnValue = slot;
+        }
+
+        slot = (slot + 1) % Slots;
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Reads the key and size byte of an entry.
+     * @return The size byte.
+     */
+    byte readHeader(uint slot, TKey& key) const
+    {
+      byte header[sizeof(TKey) + 1];
+      EEPROMUtil.readBlock(this->entryAddress(slot), header, sizeof(header));
+      key = 0;
+
+      for (uint i = 0; i < sizeof(TKey); i++)
+      {
+        key |= (TKey)header[i] << (8 * i);
+      }
+
+      return header[sizeof(TKey)];
+    }
+
+    /**
+     * @brief Gets the EEPROM address of an entry.
+     */
+    uint entryAddress(uint slot) const
+    {
+      return this->_address + (slot * ENTRY_LENGTH);
+    }
+
+    /**
+     * @brief Gets the slot where the search for a key starts.
+     */
+    static uint home(TKey key)
+    {
+      return (uint)(((uint32_t)((uint32_t)key * 2654435761UL) >> 16) % Slots);
+    }
+
+    /**
+     * @brief Gets the position of a key in the filter.
+     */
+    static uint filterBit(TKey key)
+    {
+      return (uint)(((uint32_t)((uint32_t)key * 2246822507UL) >> 16) % FilterBits);
+    }
+
+    /**
+     * @brief Checks a bit of a bitmap.
+     */
+    static bool isMarked(const byte* bitmap, uint index)
+    {
+      return (bitmap[index / 8] & (1 << (index % 8))) != 0;
+    }
+
+    /**
+     * @brief Sets or clears a bit of a bitmap.
+     */
+    static void mark(byte* bitmap, uint index, bool value)
+    {
+      if (value)
+      {
+        bitmap[index / 8] |= (1 << (index % 8));
+      }
+      else
+      {
+        bitmap[index / 8] &= ~(1 << (index % 8));
+      }
+    }
+
+    /**
+     * @brief Stores a key least significant byte first in a buffer.
+     */
+    static void putKey(byte* data, TKey key)
+    {
+      for (uint i = 0; i < sizeof(TKey); i++)
+      {
+        data[i] = (byte)(key >> (8 * i));
+      }
+    }
+
+    /**
+     * @brief Reads a checksum stored least significant byte first.
+     */
+    checksum_t readChecksum(uint address) const
+    {
+      byte data[sizeof(checksum_t)];
+      EEPROMUtil.readBlock(address, data, sizeof(checksum_t));
+      checksum_t returnValue = 0;
+
+      for (uint i = 0; i < sizeof(checksum_t); i++)
+      {
+        returnValue |= (checksum_t)data[i] << (8 * i);
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Stores a checksum least significant byte first in a buffer.
+     */
+    static void putChecksum(byte* data, checksum_t checksum)
+    {
+      for (uint i = 0; i < sizeof(checksum_t); i++)
+      {
+        data[i] = (byte)(checksum >> (8 * i));
+      }
+    }
+};
+#endif
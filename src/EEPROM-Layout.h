@@ -0,0 +1,187 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_LAYOUT_H
+#define EEPROM_LAYOUT_H
+
+/**
+ * @file EEPROM-Layout.h
+ * @brief This file contains the EEPROMLayout definition.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+  #include <EEPROM.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+#include "EEPROM-Base.h"
+
+/**
+ * @class EEPROMReserved
+ * @brief Reserves a number of raw bytes in an EEPROMLayout, for
+ * example for the journal of an EEPROMTransaction.
+ * @tparam Length The number of bytes to reserve.
+ */
+template <uint Length>
+struct EEPROMReserved
+{
+  static const uint LENGTH = Length; ///< The number of bytes reserved.
+};
+
+/**
+ * @brief Gets the address at which a variable is placed.
+ * @details Without pages, or for a variable larger than a page, the
+ * variable is placed at the given address or page boundary. A variable
+ * that fits in a page is moved to the next page boundary if it would
+ * otherwise cross one, so that it is written in a single page.
+ * @param address The first free address.
+ * @param length The number of bytes used by the variable.
+ * @param pageSize The page size of the EEPROM or 1 for no pages.
+ * @return The address of the variable.
+ */
+constexpr uint eepromLayoutPlace(uint address, uint length, uint pageSize)
+{
+  return (pageSize <= 1) ? address :
+         (length > pageSize) ? ((address + pageSize - 1) / pageSize) * pageSize :
+         ((address % pageSize) + length > pageSize) ? ((address / pageSize) + 1) * pageSize :
+         address;
+}
+
+/**
+ * @brief One variable of an EEPROMLayout and the variables after it.
+ */
+template <uint Address, uint PageSize, typename... TVariables>
+struct EEPROMLayoutNode
+{
+  static const uint END = Address; ///< The first address after the last variable.
+};
+
+template <uint Address, uint PageSize, typename TVariable, typename... TRest>
+struct EEPROMLayoutNode<Address, PageSize, TVariable, TRest...>
+{
+  typedef TVariable Variable; ///< The type of this variable.
+  static const uint LENGTH = TVariable::LENGTH; ///< The number of bytes used by this variable.
+  static const uint ADDRESS = eepromLayoutPlace(Address, LENGTH, PageSize); ///< The address of this variable.
+  typedef EEPROMLayoutNode<ADDRESS + LENGTH, PageSize, TRest...> Next; ///< The following variables.
+  static const uint END = Next::END; ///< The first address after the last variable.
+};
+
+/**
+ * @brief Finds the node of the variable at the given index.
+ */
+template <uint Index, typename TNode>
+struct EEPROMLayoutAt
+{
+  typedef typename EEPROMLayoutAt<Index - 1, typename TNode::Next>::Node Node;
+};
+
+template <typename TNode>
+struct EEPROMLayoutAt<0, TNode>
+{
+  typedef TNode Node;
+};
+
+/**
+ * @class EEPROMLayout
+ * @brief Computes the addresses of a list of variables at compile time.
+ * @details The variables are placed one after the other starting at
+ * Start, including their checksum bytes (or slots for EEPROMWearLeveled).
+ * Because each address follows from the previous variable they cannot
+ * overlap, and a layout that does not fit in EEPROM_LAYOUT_CAPACITY bytes
+ * does not compile. The variables are constructed with at<Index>(), which
+ * returns an EEPROMFixedAddress so that no address is computed or
+ * normalized at runtime.
+ *
+ *     typedef EEPROMLayout<0, 1, EEPROMStorage<uint32_t>, EEPROMCache<float>> Settings;
+ *     Settings::Type<0> bootCount(Settings::at<0>(), 0);
+ *     Settings::Type<1> gain(Settings::at<1>(), 1.0);
+ *
+ * Use START and END with disjoint() to check that two layouts do not
+ * overlap, or start the second layout at the END of the first.
+ * @tparam Start The address of the first variable.
+ * @tparam PageSize The page size of the EEPROM, or 1 to pack the variables.
+ * @tparam TVariables The types of the variables, in order.
+ */
+template <uint Start, uint PageSize, typename... TVariables>
+class EEPROMLayout
+{
+  typedef EEPROMLayoutNode<Start, PageSize, TVariables...> First;
+
+  public:
+    static const uint START = Start;                       ///< The first address of the layout.
+    static const uint END = First::END;                    ///< The first address after the layout.
+    static const uint LENGTH = END - START;                ///< The number of bytes used, including padding.
+    static const uint COUNT = sizeof...(TVariables);       ///< The number of variables.
+
+    static_assert(END <= EEPROM_LAYOUT_CAPACITY, "The EEPROM layout does not fit in EEPROM_LAYOUT_CAPACITY bytes.");
+
+    /**
+     * @brief The type of the variable at the given index.
+     */
+    template <uint Index>
+    using Type = typename EEPROMLayoutAt<Index, First>::Node::Variable;
+
+    /**
+     * @brief Gets the address of the variable at the given index.
+     */
+    template <uint Index>
+    static constexpr uint address()
+    {
+      static_assert(Index < sizeof...(TVariables), "The EEPROM layout does not have a variable at this index.");
+      return EEPROMLayoutAt<Index, First>::Node::ADDRESS;
+    }
+
+    /**
+     * @brief Gets the checked address used to construct the variable at the given index.
+     */
+    template <uint Index>
+    static constexpr EEPROMFixedAddress at()
+    {
+      return EEPROMFixedAddress(EEPROMLayout::address<Index>());
+    }
+
+    /**
+     * @brief Checks whether a range of EEPROM overlaps this layout.
+     * @param address The first address of the range.
+     * @param length The number of bytes in the range.
+     * @return True if any byte of the range is used by this layout.
+     */
+    static constexpr bool overlaps(uint address, uint length)
+    {
+      return length > 0 && address < END && START < address + length;
+    }
+
+    /**
+     * @brief Checks that another layout does not use any byte of this layout.
+     * @tparam TLayout The other layout.
+     */
+    template <typename TLayout>
+    static constexpr bool disjoint()
+    {
+      return !EEPROMLayout::overlaps(TLayout::START, TLayout::LENGTH);
+    }
+};
+#endif
@@ -0,0 +1,430 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_LOG_H
+#define EEPROM_LOG_H
+
+/**
+ * @file EEPROM-Log.h
+ * @brief This file contains the EEPROMLog<T, Capacity> definition.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+  #include <EEPROM.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+#include "EEPROM-Vars.h"
+#include "EEPROM-Util.h"
+#include "EEPROM-Checksum.h"
+#include "EEPROM-CRC.h"
+
+/**
+ * @class EEPROMLogIterator
+ * @brief Iterates over the records of an EEPROMLog from the oldest to the newest.
+ * @details Each record is read once, when the iterator moves to it. Records
+ * whose checksum is not valid are skipped.
+ * @tparam TLog The EEPROMLog being iterated.
+ */
+template <typename TLog>
+class EEPROMLogIterator
+{
+  public:
+    typedef typename TLog::value_type value_type; ///< The type of the records.
+
+    /**
+     * @brief Initialize an instance of EEPROMLogIterator at a record.
+     * @param log The log being iterated.
+     * @param index The position of the record, 0 for the oldest.
+     */
+    EEPROMLogIterator(const TLog& log, uint index) : _log(log), _index(index)
+    {
+      this->load();
+    }
+
+    /**
+     * @brief Gets the current record.
+     */
+    value_type operator * () const
+    {
+      return this->_value;
+    }
+
+    /**
+     * @brief Moves to the next valid record.
+     * @return This iterator.
+     */
+    EEPROMLogIterator& operator ++ ()
+    {
+      this->_index++;
+      this->load();
+      return *this;
+    }
+
+    /**
+     * @brief Compares the position of two iterators.
+     * @return True if the iterators are at different records.
+     */
+    bool operator != (EEPROMLogIterator const& other) const
+    {
+      return this->_index != other._index;
+    }
+
+  protected:
+    const TLog& _log;
+    uint _index;
+    value_type _value;
+
+    /**
+     * @brief Reads the record at the current position, skipping invalid records.
+     */
+    void load()
+    {
+      while (this->_index < this->_log.count() && !this->_log.get(this->_index, this->_value))
+      {
+        this->_index++;
+      }
+    }
+};
+
+/**
+ * @class EEPROMLog
+ * @brief A circular log of records of type T in EEPROM.
+ * @details The log is a ring of Capacity slots. Each slot holds a two byte
+ * sequence number, the record and a checksum covering both. An append writes
+ * the slot after the newest one with the next sequence number and nothing
+ * else, so there is no index or header cell that is written on every append
+ * and each slot is written once every Capacity appends. When the log is full
+ * the oldest record is overwritten.
+ *
+ * The newest slot is found the first time the log is used (or by recover())
+ * with a binary search for the last slot written in the same pass over the
+ * ring as slot 0, which reads about log2(Capacity) slots. If a reset interrupts
+ * an append, the slot being written fails its checksum and the log continues
+ * from the previous record.
+ *
+ *   EEPROMLog<Event, 64> events(0);
+ *   events.append(event);
+ *   for (Event e : events) { ... }
+ *
+ * @tparam T The type of the records.
+ * @tparam Capacity The number of slots (2 to 32768).
+ * @tparam TChecksum The checksum policy, Checksum<T> (default) or one
+ * of the CRC policies in EEPROM-CRC.h.
+ */
+template <typename T, uint Capacity, typename TChecksum = Checksum<T>>
+class EEPROMLog
+{
+  static_assert(Capacity >= 2 && Capacity <= 32768, "EEPROMLog requires between 2 and 32768 slots.");
+
+  public:
+    typedef T value_type;                                ///< The type of the records.
+    typedef typename TChecksum::checksum_t checksum_t;   ///< The type of the stored checksum.
+    typedef EEPROMLogIterator<EEPROMLog> Iterator;       ///< The type returned by begin() and end().
+
+    static const uint SLOT_LENGTH = 2 + sizeof(T) + sizeof(checksum_t);  ///< The number of bytes in one slot.
+    static const uint LENGTH = Capacity * SLOT_LENGTH;                   ///< The number of EEPROM bytes used by all slots.
+
+    /**
+     * @brief Initialize an instance of EEPROMLog with the specified address.
+     * @param address The address (or index) of the first slot within EEPROM.
+     */
+    EEPROMLog(const uint address)
+    {
+      this->_address = min(address, EEPROMUtil.length() - 1);
+    }
+
+    /**
+     * @brief Locates the oldest and newest records.
+     * @details Called automatically the first time the log is used. Call it
+     * again if the EEPROM was changed by something other than this instance.
+     */
+    void recover() const
+    {
+      uint16_t sequence;
+      bool found = true;
+
+      this->_count = 0;
+      this->_head = Capacity - 1;
+      this->_sequence = 0xFFFF;
+      this->_recovered = true;
+
+      if (this->readSlot(0, sequence, nullptr))
+      {
+        //
+        // The slots written in the same pass as slot 0 continue its
+        // sequence; find the last of them.
+        //
+        uint16_t first = sequence;
+        uint low = 0;
+        uint high = Capacity - 1;
+
+        while (low < high)
+        {
+          uint middle = (low + high + 1) / 2;
+
+          if (this->readSlot(middle, sequence, nullptr) && (uint16_t)(sequence - first) == middle)
+          {
+            low = middle;
+          }
+          else
+          {
+            high = middle - 1;
+          }
+        }
+
+        this->_head = low;
+        this->_sequence = first + low;
+      }
+      else if (this->readSlot(Capacity - 1, sequence, nullptr))
+      {
+        //
+        // An append to slot 0 was interrupted after the ring wrapped.
+        //
+        this->_sequence = sequence;
+      }
+      else
+      {
+        found = false;
+      }
+
+      //
+      // The oldest record follows the newest one when the ring is full,
+      // or follows the slot whose append was interrupted.
+      //
+      if (!found)
+      {
+        this->_count = 0;
+      }
+      else if (this->readSlot((this->_head + 1) % Capacity, sequence, nullptr) && sequence == (uint16_t)(this->_sequence - Capacity + 1))
+      {
+        this->_count = Capacity;
+      }
+      else if (this->readSlot((this->_head + 2) % Capacity, sequence, nullptr) && sequence == (uint16_t)(this->_sequence - Capacity + 2))
+      {
+        this->_count = Capacity - 1;
+      }
+      else
+      {
+        this->_count = this->_head + 1;
+      }
+    }
+
+    /**
+     * @brief Appends a record, overwriting the oldest record when the log is full.
+     * @param value The record to append.
+     * @param verify True to read back and compare the bytes that changed.
+     * @return True if the write succeeded (or was not verified), false otherwise.
+     */
+    bool append(T const& value, bool verify = false)
+    {
+      this->ensureRecovered();
+
+      uint slot = (this->_head + 1) % Capacity;
+      uint16_t sequence = this->_sequence + 1;
+
+      byte data[SLOT_LENGTH];
+      data[0] = (byte)sequence;
+      data[1] = (byte)(sequence >> 8);
+      memcpy(data + 2, &value, sizeof(T));
+      checksum_t checksum = TChecksum::get(data, 2 + sizeof(T));
+
+      for (uint i = 0; i < sizeof(checksum_t); i++)
+      {
+        data[2 + sizeof(T) + i] = (byte)(checksum >> (8 * i));
+      }
+
+      bool returnValue = EEPROMUtil.updateBlock(this->slotAddress(slot), data, SLOT_LENGTH, verify);
+
+      this->_head = slot;
+      this->_sequence = sequence;
+      this->_count = min(this->_count + 1, Capacity);
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Reads a record.
+     * @param index The position of the record, 0 for the oldest and count() - 1 for the newest.
+     * @param value Receives the record.
+     * @return True if the record exists and its checksum is valid, false otherwise.
+     */
+    bool get(uint index, T& value) const
+    {
+      this->ensureRecovered();
+      bool returnValue = false;
+
+      if (index < this->_count)
+      {
+        uint16_t sequence;
+        uint slot = (this->_head + Capacity - (this->_count - 1 - index)) % Capacity;
+        returnValue = this->readSlot(slot, sequence, &value) && sequence == (uint16_t)(this->_sequence - (this->_count - 1 - index));
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Reads the newest record.
+     * @param value Receives the record.
+     * @return True if the log is not empty and the record is valid, false otherwise.
+     */
+    bool newest(T& value) const
+    {
+      return this->get(this->count() - 1, value);
+    }
+
+    /**
+     * @brief Gets the number of records in the log.
+     */
+    uint count() const
+    {
+      this->ensureRecovered();
+      return this->_count;
+    }
+
+    /**
+     * @brief Gets the sequence number of the newest record.
+     * @details The sequence number wraps after 65535.
+     */
+    uint16_t sequence() const
+    {
+      this->ensureRecovered();
+      return this->_sequence;
+    }
+
+    /**
+     * @brief Removes all records by setting every slot to UNSET_VALUE.
+     */
+    void clear()
+    {
+      EEPROMUtil.fillBlock(this->_address, UNSET_VALUE, LENGTH);
+      this->recover();
+    }
+
+    /**
+     * @brief Gets an iterator at the oldest record.
+     */
+    Iterator begin() const
+    {
+      return Iterator(*this, 0);
+    }
+
+    /**
+     * @brief Gets an iterator after the newest record.
+     */
+    Iterator end() const
+    {
+      return Iterator(*this, this->count());
+    }
+
+    /**
+     * @brief Gets the maximum number of records.
+     */
+    uint capacity() const
+    {
+      return Capacity;
+    }
+
+    /**
+     * @brief Get the number of EEPROM bytes used by the log.
+     */
+    uint length() const
+    {
+      return LENGTH;
+    }
+
+    /**
+     * @brief Get the EEPROM address of the first slot.
+     */
+    uint getAddress() const
+    {
+      return this->_address;
+    }
+
+    /**
+     * @brief Gets the next EEPROM address after this log.
+     */
+    uint nextAddress() const
+    {
+      return min(this->_address + LENGTH, EEPROMUtil.length() - 1);
+    }
+
+  protected:
+    uint _address;
+    mutable uint _head = 0;              ///< The slot of the newest record.
+    mutable uint _count = 0;             ///< The number of records.
+    mutable uint16_t _sequence = 0;      ///< The sequence number of the newest record.
+    mutable bool _recovered = false;     ///< True once the newest record has been located.
+
+    /**
+     * @brief Locates the records the first time the log is used.
+     */
+    void ensureRecovered() const
+    {
+      if (!this->_recovered)
+      {
+        this->recover();
+      }
+    }
+
+    /**
+     * @brief Gets the EEPROM address of a slot.
+     */
+    uint slotAddress(uint slot) const
+    {
+      return this->_address + slot * SLOT_LENGTH;
+    }
+
+    /**
+     * @brief Reads and validates a slot.
+     * @param slot The index of the slot.
+     * @param sequence Receives the sequence number of the slot.
+     * @param value Receives the record, or nullptr to only read the sequence number.
+     * @return True if the slot checksum is valid, false otherwise.
+     */
+    bool readSlot(uint slot, uint16_t& sequence, T* value) const
+    {
+      byte data[SLOT_LENGTH];
+      EEPROMUtil.readBlock(this->slotAddress(slot), data, SLOT_LENGTH);
+      checksum_t checksum = 0;
+
+      for (uint i = 0; i < sizeof(checksum_t); i++)
+      {
+        checksum |= (checksum_t)data[2 + sizeof(T) + i] << (8 * i);
+      }
+
+      sequence = data[0] | ((uint16_t)data[1] << 8);
+
+      if (value)
+      {
+        memcpy(value, data + 2, sizeof(T));
+      }
+
+      return TChecksum::get(data, 2 + sizeof(T)) == checksum;
+    }
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,432 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_MIGRATION_H
+#define EEPROM_MIGRATION_H
+
+/**
+ * @file EEPROM-Migration.h
+ * @brief This file contains the EEPROMSchema definition and the
+ * operations used to migrate stored variables to a new layout.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+  #include <EEPROM.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+#include "EEPROM-Vars.h"
+#include "EEPROM-Util.h"
+#include "EEPROM-Checksum.h"
+#include "EEPROM-WearLeveled.h"
+
+/**
+ * @brief One operation of a migration step.
+ * @details Create operations with eepromMove(), eepromFill(), eepromSet()
+ * and eepromChecksum() rather than filling in the members.
+ */
+struct EEPROMMigration
+{
+  static const byte MOVE = 0;      ///< Copies length bytes from one address to another.
+  static const byte FILL = 1;      ///< Sets length bytes to a value.
+  static const byte SET = 2;       ///< Copies length bytes from RAM.
+  static const byte CHECKSUM = 3;  ///< Writes the checksum of a variable in its new layout.
+
+  byte type;          ///< One of MOVE, FILL, SET or CHECKSUM.
+  uint from;          ///< The source address (MOVE) or the address of the variable in its old layout (CHECKSUM).
+  uint to;            ///< The destination address, or the address of the variable in its new layout (CHECKSUM).
+  uint length;        ///< The number of bytes, or the size of the variable in its new layout (CHECKSUM).
+  uint oldLength;     ///< The size of the variable in its old layout (CHECKSUM).
+  byte value;         ///< The value written by FILL.
+  const byte* data;   ///< The bytes written by SET.
+};
+
+/**
+ * @brief Moves bytes, for example a field whose offset changed.
+ * @param from The EEPROM address of the bytes in the old layout.
+ * @param to The EEPROM address of the bytes in the new layout.
+ * @param length The number of bytes.
+ */
+inline EEPROMMigration eepromMove(uint from, uint to, uint length)
+{
+  return { EEPROMMigration::MOVE, from, to, length, 0, 0, nullptr };
+}
+
+/**
+ * @brief Sets bytes to a value, for example a new field that starts at zero.
+ * @param address The EEPROM address of the first byte.
+ * @param length The number of bytes.
+ * @param value The value of each byte.
+ */
+inline EEPROMMigration eepromFill(uint address, uint length, byte value = 0)
+{
+  return { EEPROMMigration::FILL, 0, address, length, 0, value, nullptr };
+}
+
+/**
+ * @brief Writes bytes from RAM, for example the default value of a new field.
+ * @param address The EEPROM address of the first byte.
+ * @param data The bytes to write, which must stay valid during migrate().
+ * @param length The number of bytes.
+ */
+inline EEPROMMigration eepromSet(uint address, const void* data, uint length)
+{
+  return { EEPROMMigration::SET, 0, address, length, 0, 0, (const byte*)data };
+}
+
+/**
+ * @brief Writes the checksum of a variable in its new layout.
+ * @details The checksum is only valid if the variable was valid in its old layout
+ * when the step started; otherwise an invalid checksum is written so the variable
+ * reads as its default value. List it after the operations that change the variable.
+ * @param from The EEPROM address of the variable in its old layout.
+ * @param oldLength The size of the value in its old layout, sizeof(TOld).
+ * @param to The EEPROM address of the variable in its new layout.
+ * @param length The size of the value in its new layout, sizeof(TNew).
+ */
+inline EEPROMMigration eepromChecksum(uint from, uint oldLength, uint to, uint length)
+{
+  return { EEPROMMigration::CHECKSUM, from, to, length, oldLength, 0, nullptr };
+}
+
+/**
+ * @brief The operations that upgrade the stored data to a version.
+ */
+struct EEPROMMigrationStep
+{
+  byte version;                         ///< The version after the step; the step runs on version - 1.
+  const EEPROMMigration* operations;    ///< The operations, run in order.
+  uint count;                           ///< The number of operations.
+};
+
+/**
+ * @brief The position of a migration, stored in EEPROM.
+ */
+struct EEPROMMigrationCursor
+{
+  byte version;       ///< The version of the stored data.
+  byte running;       ///< 1 while the step to version + 1 is in progress.
+  byte operation;     ///< The operation in progress.
+  uint16_t offset;    ///< The number of bytes of a MOVE already copied.
+  uint16_t valid;     ///< One bit per CHECKSUM operation whose variable was valid when the step started.
+};
+
+/**
+ * @class EEPROMSchema
+ * @brief Stores the layout version of the EEPROM data and migrates it when the
+ * firmware expects a newer version.
+ * @details The version and the position of a migration in progress are kept in
+ * an EEPROMPingPong, so they survive a reset at any point. Each step lists the
+ * fields to move, the new bytes to fill and the checksums to write. Only those
+ * bytes are written, and only where they differ from the stored bytes.
+ * The position is saved after each chunk of a move, and a move is split into
+ * chunks no longer than the distance it moves the bytes, so repeating the chunk
+ * that was interrupted gives the same result. Calling migrate()
+ * again after a reset finishes the step.
+ *
+ *   const EEPROMMigration toV2[] = { eepromMove(...), eepromSet(...), eepromChecksum(...) };
+ *   const EEPROMMigrationStep steps[] = { { 2, toV2, 3 } };
+ *   EEPROMSchema<> schema(0, 1);
+ *   schema.migrate(steps, 1);
+ *
+ * Operations run in order on absolute addresses. List the moves so that no bytes are
+ * overwritten before they have been moved, usually starting with the last field
+ * when fields move to higher addresses.
+ * @tparam TChecksum The checksum policy of the migrated variables, Checksum<byte>
+ * (default) or one of the CRC policies in EEPROM-CRC.h.
+ */
+template <typename TChecksum = Checksum<byte>>
+class EEPROMSchema
+{
+  public:
+    typedef typename TChecksum::checksum_t checksum_t; ///< The type of the stored checksum.
+
+    static const uint LENGTH = EEPROMPingPong<EEPROMMigrationCursor>::LENGTH; ///< The number of EEPROM bytes used.
+    static const uint MAX_OPERATIONS = 255;  ///< The most operations in one step, the cursor stores the position in a byte.
+    static const uint MAX_CHECKSUMS = 16;    ///< The most CHECKSUM operations in one step, the cursor stores one bit for each.
+
+    /**
+     * @brief Initialize an instance of EEPROMSchema with the specified address.
+     * @param address The address (or index) of the version within EEPROM.
+     * @param version The version of data stored before a version was written,
+     * for example by firmware that did not use EEPROMSchema.
+     */
+    EEPROMSchema(const uint address, byte version) : _cursor(address, { version, 0, 0, 0, 0 })
+    {
+    }
+
+    /**
+     * @brief Gets the version of the stored data.
+     */
+    byte version() const
+    {
+      return this->_cursor.get().version;
+    }
+
+    /**
+     * @brief Stores a version without migrating, for example after the data was
+     * written for the first time.
+     */
+    void setVersion(byte version)
+    {
+      this->_cursor.set({ version, 0, 0, 0, 0 });
+    }
+
+    /**
+     * @brief Checks whether a version has been stored.
+     */
+    bool isInitialized() const
+    {
+      return this->_cursor.isInitialized();
+    }
+
+    /**
+     * @brief Runs the steps that upgrade the stored data to the newest version.
+     * @details A step interrupted by a reset continues where it stopped. Nothing is
+     * written if the data is already at the newest version.
+     * @param steps The migration steps.
+     * @param count The number of steps.
+     * @return True if the data is at the version of the last step, false if a step is
+     * missing, has more than MAX_OPERATIONS operations or MAX_CHECKSUMS CHECKSUM
+     * operations, or the new version could not be written. Nothing is written for a
+     * step that is rejected.
+     */
+    bool migrate(const EEPROMMigrationStep* steps, uint count)
+    {
+      byte target = count ? steps[count - 1].version : this->version();
+      bool returnValue = true;
+
+      while (returnValue && this->version() != target)
+      {
+        const EEPROMMigrationStep* step = nullptr;
+
+        for (uint i = 0; i < count; i++)
+        {
+          if (steps[i].version == (byte)(this->version() + 1))
+          {
+            step = &steps[i];
+          }
+        }
+
+        returnValue = (step != nullptr) && EEPROMSchema::isSupported(*step);
+
+        if (returnValue)
+        {
+          //
+          // Stop if the new version could not be written.
+          //
+          this->run(*step);
+          returnValue = (this->version() == step->version);
+        }
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Returns the number of EEPROM bytes used.
+     */
+    uint length() const
+    {
+      return LENGTH;
+    }
+
+    /**
+     * @brief Get the EEPROM address of the version.
+     */
+    uint getAddress() const
+    {
+      return this->_cursor.getAddress();
+    }
+
+    /**
+     * @brief Gets the next EEPROM address after the version.
+     */
+    uint nextAddress() const
+    {
+      return this->_cursor.nextAddress();
+    }
+
+  protected:
+    EEPROMPingPong<EEPROMMigrationCursor> _cursor;  ///< The version and the position of a migration.
+
+    /**
+     * @brief Runs or continues one step.
+     */
+    void run(EEPROMMigrationStep const& step)
+    {
+      EEPROMMigrationCursor cursor = this->_cursor.get();
+
+      if (!cursor.running)
+      {
+        //
+        // Record which variables are valid before anything is changed.
+        //
+        cursor.running = 1;
+        cursor.operation = 0;
+        cursor.offset = 0;
+        cursor.valid = 0;
+
+        for (uint i = 0, j = 0; i < step.count; i++)
+        {
+          EEPROMMigration const& operation = step.operations[i];
+
+          if (operation.type == EEPROMMigration::CHECKSUM)
+          {
+            if (TChecksum::getEEPROM(operation.from, operation.oldLength) == this->readChecksum(operation.from + operation.oldLength))
+            {
+              cursor.valid |= (1u << j);
+            }
+
+            j++;
+          }
+        }
+
+        this->_cursor.set(cursor);
+      }
+
+      while (cursor.operation < step.count)
+      {
+        EEPROMMigration const& operation = step.operations[cursor.operation];
+
+        if (operation.type == EEPROMMigration::MOVE)
+        {
+          cursor.offset = this->moveChunk(operation, cursor.offset);
+        }
+        else if (operation.type == EEPROMMigration::FILL)
+        {
+          EEPROMUtil.fillBlock(operation.to, operation.value, operation.length);
+        }
+        else if (operation.type == EEPROMMigration::SET)
+        {
+          EEPROMUtil.updateBlock(operation.to, operation.data, operation.length);
+        }
+        else if (operation.type == EEPROMMigration::CHECKSUM)
+        {
+          this->writeChecksum(operation, (cursor.valid & (1u << this->checksumIndex(step, cursor.operation))) != 0);
+        }
+
+        if (operation.type != EEPROMMigration::MOVE || cursor.offset >= operation.length)
+        {
+          cursor.operation++;
+          cursor.offset = 0;
+        }
+
+        //
+        // Repeating a FILL, SET or CHECKSUM gives the same result, so
+        // the position only has to be saved after a chunk is moved.
+        //
+        if (operation.type == EEPROMMigration::MOVE)
+        {
+          this->_cursor.set(cursor);
+        }
+      }
+
+      this->_cursor.set({ step.version, 0, 0, 0, 0 });
+    }
+
+    /**
+     * @brief Copies the next chunk of a move.
+     * @details A chunk is no longer than the distance between the source and the
+     * destination, so it never overwrites its own source and can be repeated. Moves
+     * to a higher address copy the last bytes first.
+     * @param operation The move.
+     * @param done The number of bytes already copied.
+     * @return The number of bytes copied after this chunk.
+     */
+    uint moveChunk(EEPROMMigration const& operation, uint done)
+    {
+      uint distance = (operation.to > operation.from) ? operation.to - operation.from : operation.from - operation.to;
+      uint count = min(min(operation.length - done, (uint)EEPROM_DEVICE_BUFFER), distance ? distance : operation.length);
+      uint start = (operation.to > operation.from) ? operation.length - done - count : done;
+      byte buffer[EEPROM_DEVICE_BUFFER];
+
+      EEPROMUtil.readBlock(operation.from + start, buffer, count);
+      EEPROMUtil.updateBlock(operation.to + start, buffer, count);
+
+      return done + count;
+    }
+
+    /**
+     * @brief Checks that the cursor can hold the position and the valid bits of a step.
+     */
+    static bool isSupported(EEPROMMigrationStep const& step)
+    {
+      return step.count <= MAX_OPERATIONS && EEPROMSchema::checksumIndex(step, step.count) <= MAX_CHECKSUMS;
+    }
+
+    /**
+     * @brief Gets the position of a CHECKSUM operation among the CHECKSUM operations of a step.
+     */
+    static uint checksumIndex(EEPROMMigrationStep const& step, uint index)
+    {
+      uint returnValue = 0;
+
+      for (uint i = 0; i < index; i++)
+      {
+        returnValue += (step.operations[i].type == EEPROMMigration::CHECKSUM) ? 1 : 0;
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Writes the checksum of a variable in its new layout.
+     * @param operation The CHECKSUM operation.
+     * @param valid False to write a checksum that does not match.
+     */
+    void writeChecksum(EEPROMMigration const& operation, bool valid)
+    {
+      checksum_t checksum = TChecksum::getEEPROM(operation.to, operation.length);
+      checksum = valid ? checksum : (checksum_t)(checksum ^ 1);
+      byte data[sizeof(checksum_t)];
+
+      for (uint i = 0; i < sizeof(checksum_t); i++)
+      {
+        data[i] = (byte)(checksum >> (8 * i));
+      }
+
+      EEPROMUtil.updateBlock(operation.to + operation.length, data, sizeof(checksum_t));
+    }
+
+    /**
+     * @brief Reads a checksum stored least significant byte first.
+     */
+    checksum_t readChecksum(uint address) const
+    {
+      byte data[sizeof(checksum_t)];
+      EEPROMUtil.readBlock(address, data, sizeof(checksum_t));
+      checksum_t returnValue = 0;
+
+      for (uint i = 0; i < sizeof(checksum_t); i++)
+      {
+        returnValue |= (checksum_t)data[i] << (8 * i);
+      }
+
+      return returnValue;
+    }
+};
+#endif
@@ -0,0 +1,296 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_MIRROR_H
+#define EEPROM_MIRROR_H
+
+/**
+ * @file EEPROM-Mirror.h
+ * @brief This file contains the EEPROMMirror definition.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+  #include <EEPROM.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+#include "EEPROM-Vars.h"
+#include "EEPROM-Device.h"
+#include "EEPROM-Util.h"
+
+/**
+ * @class EEPROMMirror
+ * @brief Keeps a RAM image of the EEPROM and writes it back later.
+ * @details begin() reads the EEPROM into RAM and routes EEPROMUtil to
+ * the mirror, so every variable reads from RAM and every write only
+ * changes RAM and marks its page of EEPROM_MIRROR_PAGE bytes as dirty.
+ * The dirty pages are written to the EEPROM by sync(), by poll() once
+ * the oldest unsaved write is older than the deadline, or as soon as
+ * the bytes written since the last sync reach the budget. Only the
+ * changed bytes of each dirty page are written. On ESP8266 and ESP32
+ * sync() also calls EEPROM.commit(). Writes that have not been synced
+ * are lost if the power fails. When the EEPROM is larger than the
+ * mirror the bytes past Length are read and written straight to the
+ * EEPROM, and EEPROMUtil.length() still reports the whole EEPROM.
+ * @tparam Length The number of bytes to mirror, starting at address 0.
+ * The mirror uses Length bytes of RAM.
+ */
+template <uint Length>
+class EEPROMMirror : public EEPROMDevice
+{
+  public:
+    /**
+     * @brief Creates a mirror of the internal EEPROM or of the given device.
+     * @param backing The EEPROM to mirror, or nullptr for the internal EEPROM.
+     */
+    EEPROMMirror(EEPROMDevice* backing = nullptr) : _backing(backing) {}
+
+    /**
+     * @brief Reads the EEPROM into RAM and routes EEPROMUtil to the mirror.
+     */
+    void begin()
+    {
+      EEPROMUtil.setDevice(this->_backing);
+      this->_eepromLength = EEPROMUtil.length();
+      this->_length = min(Length, this->_eepromLength);
+      EEPROMUtil.readBlock(0, this->_data, this->_length);
+      memset(this->_dirty, 0, sizeof(this->_dirty));
+      this->_pending = 0;
+      EEPROMUtil.setDevice(this);
+    }
+
+    /**
+     * @brief Writes the dirty pages and routes EEPROMUtil back to the EEPROM.
+     */
+    void end()
+    {
+      this->sync();
+      EEPROMUtil.setDevice(this->_backing);
+    }
+
+    /**
+     * @brief Writes every dirty page to the EEPROM.
+     */
+    void sync()
+    {
+      if (this->isDirty())
+      {
+        EEPROMDevice* device = EEPROMUtil.getDevice();
+        EEPROMUtil.setDevice(this->_backing);
+
+        //
+        // Write each run of dirty pages as one block. Only the
+        // bytes that differ from the EEPROM are written.
+        //
+        uint start = 0;
+
+        for (uint page = 0; page <= PAGES; page++)
+        {
+          if (page == PAGES || !this->isDirtyPage(page))
+          {
+            uint end = min(page * EEPROM_MIRROR_PAGE, this->_length);
+
+            if (end > start)
+            {
+              EEPROMUtil.updateBlock(start, this->_data + start, end - start);
+            }
+
+            start = (page + 1) * EEPROM_MIRROR_PAGE;
+          }
+        }
+
+        #if defined(ESP8266) || defined(ESP32)
+        if (!this->_backing)
+        {
+          EEPROM.commit();
+        }
+        #endif
+
+        memset(this->_dirty, 0, sizeof(this->_dirty));
+        this->_pending = 0;
+        EEPROMUtil.setDevice(device);
+      }
+    }
+
+    /**
+     * @brief Calls sync() when the oldest unsaved write is older than the deadline.
+     * @details Call this method from loop().
+     */
+    void poll()
+    {
+      if (this->isDirty() && this->_deadline > 0 && (millis() - this->_dirtySince) >= this->_deadline)
+      {
+        this->sync();
+      }
+    }
+
+    /**
+     * @brief Sets the longest time a write is kept in RAM before poll() writes it.
+     * @param milliseconds The deadline, or 0 to only write on sync() or the budget.
+     */
+    void setDeadline(unsigned long milliseconds)
+    {
+      this->_deadline = milliseconds;
+    }
+
+    /**
+     * @brief Sets the number of bytes written to RAM that causes an immediate sync().
+     * @param bytes The budget, or 0 to only write on sync() or the deadline.
+     */
+    void setBudget(uint bytes)
+    {
+      this->_budget = bytes;
+    }
+
+    /**
+     * @brief Checks whether any page has not been written to the EEPROM.
+     */
+    bool isDirty() const
+    {
+      bool returnValue = false;
+
+      for (uint i = 0; i < sizeof(this->_dirty); i++)
+      {
+        if (this->_dirty[i] != 0)
+        {
+          returnValue = true;
+          break;
+        }
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Gets the number of bytes written to RAM since the last sync().
+     */
+    uint pending() const
+    {
+      return this->_pending;
+    }
+
+    uint length()
+    {
+      return this->_eepromLength;
+    }
+
+    /**
+     * @brief Gets the number of bytes that can be written at once.
+     * @details Writes to RAM are not limited to a page, so the whole
+     * mirror is reported as a single page.
+     */
+    uint pageSize()
+    {
+      return Length;
+    }
+
+    byte read(uint address)
+    {
+      byte returnValue = UNSET_VALUE;
+      this->read(address, &returnValue, 1);
+      return returnValue;
+    }
+
+    void read(uint address, byte* data, uint length)
+    {
+      uint count = (address < this->_length) ? min(length, this->_length - address) : 0;
+      memcpy(data, this->_data + address, count);
+
+      if (count < length)
+      {
+        //
+        // The bytes past the mirror are read from the EEPROM.
+        //
+        EEPROMDevice* device = EEPROMUtil.getDevice();
+        EEPROMUtil.setDevice(this->_backing);
+        EEPROMUtil.readBlock(address + count, data + count, length - count);
+        EEPROMUtil.setDevice(device);
+      }
+    }
+
+    bool write(uint address, const byte* data, uint length)
+    {
+      bool returnValue = true;
+      uint count = (address < this->_length) ? min(length, this->_length - address) : 0;
+
+      if (count > 0)
+      {
+        if (!this->isDirty())
+        {
+          this->_dirtySince = millis();
+        }
+
+        memcpy(this->_data + address, data, count);
+
+        for (uint page = address / EEPROM_MIRROR_PAGE; page <= (address + count - 1) / EEPROM_MIRROR_PAGE; page++)
+        {
+          this->_dirty[page / 8] |= (1 << (page % 8));
+        }
+
+        this->_pending += count;
+
+        if (this->_budget > 0 && this->_pending >= this->_budget)
+        {
+          this->sync();
+        }
+      }
+
+      if (count < length)
+      {
+        //
+        // The bytes past the mirror are written to the EEPROM.
+        //
+        EEPROMDevice* device = EEPROMUtil.getDevice();
+        EEPROMUtil.setDevice(this->_backing);
+        returnValue = EEPROMUtil.updateBlock(address + count, data + count, length - count);
+        EEPROMUtil.setDevice(device);
+      }
+
+      return returnValue;
+    }
+
+  protected:
+    static const uint PAGES = (Length + EEPROM_MIRROR_PAGE - 1) / EEPROM_MIRROR_PAGE;
+
+    EEPROMDevice* _backing;
+    uint _length = 0;
+    uint _eepromLength = 0;
+    uint _pending = 0;
+    uint _budget = EEPROM_MIRROR_BUDGET;
+    unsigned long _deadline = EEPROM_MIRROR_DEADLINE;
+    unsigned long _dirtySince = 0;
+    byte _data[Length];
+    byte _dirty[(PAGES + 7) / 8] = { 0 };
+
+    /**
+     * @brief Checks whether a page has changed since the last sync().
+     */
+    bool isDirtyPage(uint page) const
+    {
+      return (this->_dirty[page / 8] & (1 << (page % 8))) != 0;
+    }
+};
+#endif
@@ -0,0 +1,201 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_OPERATORS_H
+#define EEPROM_OPERATORS_H
+
+/**
+ * @file EEPROM-Operators.h
+ * @brief This file contains the EEPROMOperators<T, TVariable> definition.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+/**
+ * @class EEPROMOperators
+ * @brief The increment, decrement and compound assignment operators of an EEPROM variable.
+ * @details Each operator reads the value with get() and writes the result with set()
+ * of the derived class TVariable (CRTP). The class has no members, so it adds nothing
+ * to the size of the derived class. It is shared by EEPROMBase and EEPROMArrayElement.
+ * @tparam T The type of the variable stored.
+ * @tparam TVariable The derived class, which provides get() and set().
+ */
+template <typename T, typename TVariable>
+class EEPROMOperators
+{
+  public:
+    /**
+     * @brief Postfix increment operator.
+     * @return The value before incrementing as type T.
+     */
+    T operator ++ (int)
+    {
+      T oldValue = this->variable().get();
+      this->variable().set(oldValue + 1);
+      return oldValue;
+    }
+
+    /**
+     * @brief Prefix increment operator.
+     * @return The value after incrementing as type T.
+     */
+    T operator ++ ()
+    {
+      return this->variable().set(this->variable().get() + 1);
+    }
+
+    /**
+     * @brief Postfix decrement operator.
+     * @return The value before decrementing as type T.
+     */
+    T operator -- (int)
+    {
+      T oldValue = this->variable().get();
+      this->variable().set(oldValue - 1);
+      return oldValue;
+    }
+
+    /**
+     * @brief Postfix decrement operator.
+     * @return The value before decrementing as type T.
+     */
+    T operator -- ()
+    {
+      return this->variable().set(this->variable().get() - 1);
+    }
+
+    /**
+     * @brief Addition assignment operator.
+     * @param value The value to add.
+     * @return The result of the addition as type T.
+     */
+    T operator += (T const& value)
+    {
+      return this->variable().set(this->variable().get() + value);
+    }
+
+    /**
+     * @brief Subtraction assignment operator.
+     * @param value The value to subtract.
+     * @return The result of the subtraction as type T.
+     */
+    T operator -= (T const& value)
+    {
+      return this->variable().set(this->variable().get() - value);
+    }
+
+    /**
+     * @brief Multiplication assignment operator.
+     * @tparam value The value to multiply by.
+     * @return The result of the multiplication as type T.
+     */
+    T operator *= (T const& value)
+    {
+      return this->variable().set(this->variable().get() * value);
+    }
+
+    /**
+     * @brief Division assignment operator.
+     * @tparam value The value to divide by.
+     * @return The result of the division as type T.
+     */
+    T operator /= (T const& value)
+    {
+      return this->variable().set(this->variable().get() / value);
+    }
+
+    /**
+     * @brief Bitwise XOR assignment operator.
+     * @tparam value The value to XOR with.
+     * @return The result of the XOR operation as type T.
+     */
+    T operator ^= (T const& value)
+    {
+      return this->variable().set(this->variable().get() ^ value);
+    }
+
+    /**
+     * @brief Modulus assignment operator.
+     * @tparam value The value to mod with.
+     * @return The result of the modulus operation as type T.
+     */
+    T operator %= (T const& value)
+    {
+      return this->variable().set(this->variable().get() % value);
+    }
+
+    /**
+     * @brief Bitwise AND assignment operator.
+     * @tparam value The value to AND with.
+     * @return The result of the AND operation as type T.
+     */
+    T operator &= (T const& value)
+    {
+      return this->variable().set(this->variable().get() & value);
+    }
+
+    /**
+     * @brief Bitwise OR assignment operator.
+     * @tparam value The value to OR with.
+     * @return The result of the OR operation as type T.
+     */
+    T operator |= (T const& value)
+    {
+      return this->variable().set(this->variable().get() | value);
+    }
+
+    /**
+     * @brief Bitwise left shift assignment operator.
+     * @tparam value The value to shift by.
+     * @return The result of the left shift operation as type T.
+     */
+    T operator <<= (T const& value)
+    {
+      return this->variable().set(this->variable().get() << value);
+    }
+
+    /**
+     * @brief Bitwise right shift assignment operator.
+     * @tparam value The value to shift by.
+     * @return The result of the right shift operation as type T.
+     */
+    T operator >>= (T const& value)
+    {
+      return this->variable().set(this->variable().get() >> value);
+    }
+
+  protected:
+    /**
+     * @brief Gets this instance as the derived class.
+     */
+    TVariable& variable()
+    {
+      return static_cast<TVariable&>(*this);
+    }
+};
+#endif
\ No newline at end of file
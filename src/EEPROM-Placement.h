@@ -0,0 +1,188 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_PLACEMENT_H
+#define EEPROM_PLACEMENT_H
+
+/**
+ * @file EEPROM-Placement.h
+ * @brief This file contains the placement policies that hold the
+ * address and default value of an EEPROM variable.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+#include "EEPROM-Vars.h"
+#include "EEPROM-Registry.h"
+
+#if defined(PARTICLE) && !defined(memcpy_P)
+  #define memcpy_P memcpy
+#endif
+
+/**
+ * @class EEPROMPlacement
+ * @brief Holds the address and default value of a variable in RAM.
+ * @details This is the placement used by EEPROMStorage<T> and
+ * EEPROMCache<T> unless another one is given. The address and default
+ * value are passed to the constructor.
+ * @tparam T The type of the variable stored.
+ */
+template <typename T>
+class EEPROMPlacement
+{
+  public:
+    static const bool STATIC = false; ///< True when the address is known at compile time.
+
+    /**
+     * @brief Gets the default value for this instance.
+     * @return The default value as type T.
+     */
+    T getDefaultValue() const
+    {
+      return this->_defaultValue;
+    }
+
+  protected:
+    friend class EEPROMRegistryClass;
+
+    /**
+     * @brief The address of this variable in the EEPROM.
+     * @details This variable cannot/will not be modified after instantiation.
+     */
+    uint _address = 0;
+
+    #if EEPROM_USE_REGISTRY
+    /**
+     * @brief The index of this variable in EEPROMRegistry or
+     * EEPROMRegistryClass::NO_INDEX if it has not been added.
+     */
+    byte _registryIndex = EEPROMRegistryClass::NO_INDEX;
+    #endif
+
+    /**
+     * @brief The default value.
+     * @details The default value to return when the EEPROM has not
+     * been initialized. This variable cannot/will not be modified
+     * after instantiation.
+     */
+    T _defaultValue;
+};
+
+/**
+ * @class EEPROMStaticPlacement
+ * @brief Holds the address and default value of a variable at compile time.
+ * @details The address is a template parameter and the default value is
+ * provided by TDefault, so an instance uses no RAM for either. Variables
+ * with this placement are created without constructor arguments.
+ * @tparam T The type of the variable stored.
+ * @tparam Address The address of the variable within EEPROM.
+ * @tparam TDefault Provides the default value: EEPROMDefault<T> (default),
+ * EEPROMConstant, EEPROMProgmem or EEPROMFunction.
+ */
+template <typename T, uint Address, typename TDefault>
+class EEPROMStaticPlacement
+{
+  static_assert(Address < EEPROM_LAYOUT_CAPACITY, "The address is outside of EEPROM_LAYOUT_CAPACITY.");
+
+  public:
+    static const bool STATIC = true; ///< True when the address is known at compile time.
+
+    /**
+     * @brief Gets the default value for this instance.
+     * @return The default value as type T.
+     */
+    T getDefaultValue() const
+    {
+      return TDefault::get();
+    }
+
+  protected:
+    friend class EEPROMRegistryClass;
+
+    static const uint _address = Address;  ///< The address of this variable in the EEPROM.
+
+    #if EEPROM_USE_REGISTRY
+    /**
+     * @brief The index in EEPROMRegistry, shared by every instance at this address.
+     */
+    static byte _registryIndex;
+    #endif
+};
+
+template <typename T, uint Address, typename TDefault>
+const uint EEPROMStaticPlacement<T, Address, TDefault>::_address;
+
+#if EEPROM_USE_REGISTRY
+template <typename T, uint Address, typename TDefault>
+byte EEPROMStaticPlacement<T, Address, TDefault>::_registryIndex = EEPROMRegistryClass::NO_INDEX;
+#endif
+
+/**
+ * @brief Provides T{} as the default value.
+ */
+template <typename T>
+struct EEPROMDefault
+{
+  static T get() { return T{}; }
+};
+
+/**
+ * @brief Provides a compile time constant as the default value.
+ * @details T must be an integral or enumeration type.
+ */
+template <typename T, T Value>
+struct EEPROMConstant
+{
+  static T get() { return Value; }
+};
+
+/**
+ * @brief Provides a default value stored in flash with PROGMEM.
+ * @details Value must point to a variable with static storage, for
+ * example: const Settings defaults PROGMEM = { ... };
+ */
+template <typename T, const T* Value>
+struct EEPROMProgmem
+{
+  static T get()
+  {
+    T returnValue;
+    memcpy_P(&returnValue, Value, sizeof(T));
+    return returnValue;
+  }
+};
+
+/**
+ * @brief Provides the default value returned by a function.
+ */
+template <typename T, T (*Function)()>
+struct EEPROMFunction
+{
+  static T get() { return Function(); }
+};
+#endif
@@ -0,0 +1,341 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_REGISTRY_H
+#define EEPROM_REGISTRY_H
+
+/**
+ * @file EEPROM-Registry.h
+ * @brief This file contains the EEPROMRegistryClass definition.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+  #include <EEPROM.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+#include "EEPROM-Vars.h"
+#include "EEPROM-Util.h"
+
+/**
+ * @class EEPROMRegistryClass
+ * @brief Validates the checksums of many variables in one pass and
+ * caches the results.
+ * @details Variables added with add() are validated by scan(), which
+ * reads the EEPROM once in address order, in blocks of up to
+ * EEPROM_REGISTRY_BUFFER bytes that each end with a variable. The result for each
+ * variable is kept in a bitmap and isInitialized() returns it without
+ * reading the EEPROM until the variable is written or unset. Writes
+ * made without the variable (for example with EEPROMUtil) are not
+ * tracked; call invalidate() after them. Variables only use the registry
+ * when EEPROM_USE_REGISTRY is true.
+ */
+class EEPROMRegistryClass
+{
+  public:
+    static const byte NO_INDEX = 0xFF; ///< The index of a variable that has not been added.
+
+    /**
+     * @brief Gets the instance used by the library, named EEPROMRegistry.
+     */
+    static EEPROMRegistryClass& instance()
+    {
+      static EEPROMRegistryClass returnValue;
+      return returnValue;
+    }
+
+    /**
+     * @brief Adds an EEPROMStorage<T> or EEPROMCache<T> variable to the registry.
+     * @details Adding a variable whose address and type are already registered
+     * reuses the existing entry. EEPROMWearLeveled variables keep their own index
+     * of the newest slot and cannot be added.
+     * @param variable The variable to add.
+     * @return False if EEPROM_REGISTRY_SIZE variables were already added, true otherwise.
+     */
+    template <template <typename, typename, typename> class TVariable, typename T, typename TChecksum, typename TPlacement>
+    bool add(TVariable<T, TChecksum, TPlacement>& variable)
+    {
+      static_assert(EEPROM_USE_REGISTRY && sizeof(T) > 0,
+                    "Define EEPROM_USE_REGISTRY as true before including the library to use EEPROMRegistry.");
+      static_assert(TVariable<T, TChecksum, TPlacement>::LENGTH == sizeof(T) + sizeof(typename TChecksum::checksum_t),
+                    "Only EEPROMStorage<T> and EEPROMCache<T> variables can be added to the registry.");
+
+      Validate validate = &EEPROMRegistryClass::validate<T, TChecksum>;
+      byte index = this->find(variable.getAddress(), validate);
+
+      if (index == NO_INDEX && this->_count < EEPROM_REGISTRY_SIZE)
+      {
+        index = this->_count++;
+        this->_entries[index].address = variable.getAddress();
+        this->_entries[index].length = TVariable<T, TChecksum, TPlacement>::LENGTH;
+        this->_entries[index].validate = validate;
+        this->_entries[index].validateEEPROM = &EEPROMRegistryClass::validateEEPROM<T, TChecksum>;
+        this->forget(index);
+      }
+
+      #if EEPROM_USE_REGISTRY
+      variable._registryIndex = index;
+      #endif
+
+      return index != NO_INDEX;
+    }
+
+    /**
+     * @brief Validates the checksum of every added variable.
+     * @return The number of variables that are initialized.
+     */
+    uint scan()
+    {
+      uint returnValue = 0;
+      byte buffer[EEPROM_REGISTRY_BUFFER];
+      bool done[EEPROM_REGISTRY_SIZE];
+      memset(done, 0, sizeof(done));
+
+      for (byte scanned = 0; scanned < this->_count; )
+      {
+        //
+        // Start the next block at the lowest address not yet validated.
+        //
+        byte first = NO_INDEX;
+
+        for (byte i = 0; i < this->_count; i++)
+        {
+          if (!done[i] && (first == NO_INDEX || this->_entries[i].address < this->_entries[first].address))
+          {
+            first = i;
+          }
+        }
+
+        uint start = this->_entries[first].address;
+        uint end = start + this->_entries[first].length;
+
+        //
+        // Extend the block to the end of the last variable that fits.
+        //
+        for (byte i = 0; i < this->_count; i++)
+        {
+          uint last = this->_entries[i].address + this->_entries[i].length;
+
+          if (!done[i] && this->_entries[i].address >= start && last <= start + EEPROM_REGISTRY_BUFFER)
+          {
+            end = max(end, last);
+          }
+        }
+
+        if (end - start > EEPROM_REGISTRY_BUFFER)
+        {
+          //
+          // The variable is larger than the buffer.
+          //
+          bool valid = this->_entries[first].validateEEPROM(start);
+          this->cache(first, valid);
+          done[first] = true;
+          scanned++;
+          returnValue += valid ? 1 : 0;
+        }
+        else
+        {
+          EEPROMUtil.readBlock(start, buffer, end - start);
+
+          for (byte i = 0; i < this->_count; i++)
+          {
+            Entry& entry = this->_entries[i];
+
+            if (!done[i] && entry.address >= start && entry.address + entry.length <= end)
+            {
+              bool valid = entry.validate(buffer + (entry.address - start));
+              this->cache(i, valid);
+              done[i] = true;
+              scanned++;
+              returnValue += valid ? 1 : 0;
+            }
+          }
+        }
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Forgets the cached result of every variable.
+     */
+    void invalidate()
+    {
+      memset(this->_known, 0, sizeof(this->_known));
+    }
+
+    /**
+     * @brief Forgets the cached result of one variable.
+     * @param index The index of the variable.
+     */
+    void forget(byte index)
+    {
+      if (index < this->_count)
+      {
+        this->_known[index / 8] &= ~(1 << (index % 8));
+      }
+    }
+
+    /**
+     * @brief Stores the result of validating one variable.
+     * @param index The index of the variable.
+     * @param valid True if the checksum of the variable is valid.
+     */
+    void cache(byte index, bool valid)
+    {
+      if (index < this->_count)
+      {
+        this->_known[index / 8] |= (1 << (index % 8));
+
+        if (valid)
+        {
+          this->_valid[index / 8] |= (1 << (index % 8));
+        }
+        else
+        {
+          this->_valid[index / 8] &= ~(1 << (index % 8));
+        }
+      }
+    }
+
+    /**
+     * @brief Checks whether the result of a variable is cached.
+     * @param index The index of the variable.
+     */
+    bool isKnown(byte index) const
+    {
+      return index < this->_count && (this->_known[index / 8] & (1 << (index % 8)));
+    }
+
+    /**
+     * @brief Gets the cached result of a variable.
+     * @param index The index of the variable.
+     */
+    bool isValid(byte index) const
+    {
+      return index < this->_count && (this->_valid[index / 8] & (1 << (index % 8)));
+    }
+
+    /**
+     * @brief Gets the number of variables added.
+     */
+    uint count() const
+    {
+      return this->_count;
+    }
+
+    /**
+     * @brief Removes every variable from the registry.
+     * @details Variables added before calling clear() must not be used
+     * with the registry until they are added again.
+     */
+    void clear()
+    {
+      this->_count = 0;
+      this->invalidate();
+    }
+
+  protected:
+    typedef bool (*Validate)(const byte*);
+    typedef bool (*ValidateEEPROM)(uint);
+
+    /**
+     * @brief The address, length and checksum functions of one variable.
+     */
+    struct Entry
+    {
+      uint address;
+      uint length;
+      Validate validate;
+      ValidateEEPROM validateEEPROM;
+    };
+
+    Entry _entries[EEPROM_REGISTRY_SIZE] = {};
+    byte _count = 0;
+    byte _known[(EEPROM_REGISTRY_SIZE + 7) / 8] = { 0 };
+    byte _valid[(EEPROM_REGISTRY_SIZE + 7) / 8] = { 0 };
+
+    /**
+     * @brief Finds an entry with the same address and type.
+     */
+    byte find(uint address, Validate validate) const
+    {
+      byte returnValue = NO_INDEX;
+
+      for (byte i = 0; i < this->_count; i++)
+      {
+        if (this->_entries[i].address == address && this->_entries[i].validate == validate)
+        {
+          returnValue = i;
+          break;
+        }
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Compares the checksum of a value to the checksum stored after it.
+     */
+    template <typename T, typename TChecksum>
+    static bool validate(const byte* data)
+    {
+      typedef typename TChecksum::checksum_t checksum_t;
+      checksum_t stored = 0;
+
+      for (uint i = 0; i < sizeof(checksum_t); i++)
+      {
+        stored |= (checksum_t)data[sizeof(T) + i] << (8 * i);
+      }
+
+      return TChecksum::get((byte*)data, sizeof(T)) == stored;
+    }
+
+    /**
+     * @brief Validates a variable larger than the scan buffer from EEPROM.
+     */
+    template <typename T, typename TChecksum>
+    static bool validateEEPROM(uint address)
+    {
+      typedef typename TChecksum::checksum_t checksum_t;
+      byte data[sizeof(checksum_t)];
+      EEPROMUtil.readBlock(address + sizeof(T), data, sizeof(checksum_t));
+      checksum_t stored = 0;
+
+      for (uint i = 0; i < sizeof(checksum_t); i++)
+      {
+        stored |= (checksum_t)data[i] << (8 * i);
+      }
+
+      return TChecksum::getEEPROM(address, sizeof(T)) == stored;
+    }
+};
+
+/**
+ * @brief The EEPROMRegistryClass instance shared by every file of the program.
+ */
+#define EEPROMRegistry (EEPROMRegistryClass::instance())
+#endif
@@ -33,6 +33,8 @@
   #include <EEPROM.h>
 #elif defined(PARTICLE)
   #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
 #endif
 
 #include "EEPROM-Base.h"
@@ -45,16 +47,26 @@
  * directly from the EEPROM variable. Subsequently, writing the
  * variable value is done directly to the EEPROM memory.
  * @tparam T The type of the variable stored.
+ * @tparam TChecksum The checksum policy, Checksum<T> (default) or one
+ * of the CRC policies in EEPROM-CRC.h.
+ * @tparam TPlacement Holds the address and default value, see EEPROM-Placement.h.
  */
-template <typename T>
-class EEPROMStorage : public EEPROMBase<T>
+template <typename T, typename TChecksum = Checksum<T>, typename TPlacement = EEPROMPlacement<T>>
+class EEPROMStorage : public EEPROMBase<T, TChecksum, EEPROMStorage<T, TChecksum, TPlacement>, TPlacement>
 {
   public:
+    /**
+     * @brief Initialize an instance of EEPROMStorage<T> with an EEPROMStaticPlacement.
+     */
+    EEPROMStorage()
+    {
+    }
+
     /**
      * @brief Initialize an instance of EEPROMStorage<T> with the specified address.
      * @param address The address (or index) of the variable within EEPROM.
      */
-    EEPROMStorage(const uint address) : EEPROMBase<T>(address)
+    EEPROMStorage(const uint address) : EEPROMBase<T, TChecksum, EEPROMStorage<T, TChecksum, TPlacement>, TPlacement>(address)
     {
     }
 
@@ -63,7 +75,24 @@ class EEPROMStorage : public EEPROMBase<T>
      * @param address The address (or index) of the variable within EEPROM.
      * @tparam defaultValue The default value returned when the variable has not been initialized.
      */
-    EEPROMStorage(const uint address, T defaultValue) : EEPROMBase<T>(address, defaultValue)
+    EEPROMStorage(const uint address, T defaultValue) : EEPROMBase<T, TChecksum, EEPROMStorage<T, TChecksum, TPlacement>, TPlacement>(address, defaultValue)
+    {
+    }
+
+    /**
+     * @brief Initialize an instance of EEPROMStorage<T> with an address checked by EEPROMLayout.
+     * @param address The checked address (or index) of the variable within EEPROM.
+     */
+    EEPROMStorage(EEPROMFixedAddress address) : EEPROMBase<T, TChecksum, EEPROMStorage<T, TChecksum, TPlacement>, TPlacement>(address)
+    {
+    }
+
+    /**
+     * @brief Initialize an instance of EEPROMStorage<T> with an address checked by EEPROMLayout and a default value.
+     * @param address The checked address (or index) of the variable within EEPROM.
+     * @tparam defaultValue The default value returned when the variable has not been initialized.
+     */
+    EEPROMStorage(EEPROMFixedAddress address, T defaultValue) : EEPROMBase<T, TChecksum, EEPROMStorage<T, TChecksum, TPlacement>, TPlacement>(address, defaultValue)
     {
     }
 
@@ -74,7 +103,7 @@ class EEPROMStorage : public EEPROMBase<T>
      * @tparam item The new value to store in EEPROM.
      * @return A reference to the EEPROMStorage<T> variable.
      */
-    EEPROMStorage<T>& operator = (T const& value)
+    EEPROMStorage<T, TChecksum, TPlacement>& operator = (T const& value)
     {
       this->set(value);
       return *this;
@@ -86,7 +115,7 @@ class EEPROMStorage : public EEPROMBase<T>
      * @tparam item The new value to store in EEPROM.
      * @return A reference to the EEPROMStorage<T> variable.
      */
-    EEPROMStorage<T>& operator = (EEPROMStorage<T> const& item)
+    EEPROMStorage<T, TChecksum, TPlacement>& operator = (EEPROMStorage<T, TChecksum, TPlacement> const& item)
     {
       this->set(item.get());
       return *this;
@@ -103,13 +132,151 @@ class EEPROMStorage : public EEPROMBase<T>
 
     /**
      * @brief Set the variable value.
+     * @details The value is written in a single pass and returned without
+     * reading it back. When EEPROM_VERIFY_WRITES is enabled the changed bytes
+     * are verified and, on a mismatch, the value actually stored is returned.
      * @tparam value The new value to store in EEPROM.
      * @return The stored value as type T.
      */
     T set(T const& value)
     {
-      this->write(value);
-      return this->get();
+      T returnValue = value;
+
+      if (!this->write(value, EEPROM_VERIFY_WRITES))
+      {
+        returnValue = this->read();
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Get one member of a structure without reading the whole value.
+     * @details When EEPROM_USE_REGISTRY is true and EEPROMRegistry knows whether
+     * the variable is initialized only the bytes of the member are read. Otherwise
+     * the whole value is read once, as by get(), and the member is taken from it. When the variable has not
+     * been initialized the member of the default value is returned.
+     * @param member A pointer to the member, for example &MyStruct::count.
+     * @return The value of the member.
+     */
+    template <typename F, typename C>
+    F getField(F C::*member) const
+    {
+      F returnValue;
+
+      #if EEPROM_USE_REGISTRY
+      if (!EEPROMRegistry.isKnown(this->_registryIndex))
+      {
+        T item;
+        this->read(item);
+        returnValue = item.*member;
+      }
+      else if (EEPROMRegistry.isValid(this->_registryIndex))
+      {
+        EEPROMUtil.readBlock(this->_address + EEPROMStorage::offsetOf(member), (byte*)&returnValue, sizeof(F));
+      }
+      else
+      {
+        returnValue = this->getDefaultValue().*member;
+      }
+      #else
+      T item;
+      this->read(item);
+      returnValue = item.*member;
+      #endif
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Set one member of a structure without writing the whole value.
+     * @details Only the changed bytes of the member and of the checksum are written.
+     * The checksum is updated from the old and new bytes of the member with
+     * TChecksum::replace() and only recomputed from the EEPROM when the stored
+     * checksum is ambiguous. When the variable
+     * has not been initialized the default value with the new member is written.
+     * @param member A pointer to the member, for example &MyStruct::count.
+     * @param value The new value of the member.
+     * @return The stored value of the member.
+     */
+    template <typename F, typename C>
+    F setField(F C::*member, F const& value)
+    {
+      F returnValue = value;
+
+      if (!this->isInitialized())
+      {
+        T item = this->getDefaultValue();
+        item.*member = value;
+        this->set(item);
+      }
+      else
+      {
+        uint address = this->_address + EEPROMStorage::offsetOf(member);
+        F current;
+        EEPROMUtil.readBlock(address, (byte*)&current, sizeof(F));
+
+        if (memcmp(&current, &value, sizeof(F)) != 0)
+        {
+          typename TChecksum::checksum_t checksum = this->checksumByte();
+          bool updated = TChecksum::replace(checksum, address - this->_address, (const byte*)&current, (const byte*)&value, sizeof(F));
+
+          #if EEPROM_USE_REGISTRY
+          EEPROMRegistry.forget(this->_registryIndex);
+          #endif
+
+          bool verified = EEPROMUtil.updateBlock(address, (const byte*)&value, sizeof(F), EEPROM_VERIFY_WRITES);
+
+          if (!updated)
+          {
+            checksum = TChecksum::getEEPROM(this->_address, sizeof(T));
+          }
+
+          verified = this->writeChecksum(this->checksumAddress(), checksum, EEPROM_VERIFY_WRITES) && verified;
+
+          //
+          // The checksum matches the new bytes, so the variable
+          // is still initialized unless a write failed.
+          //
+          if (!verified)
+          {
+            returnValue = this->getField(member);
+          }
+          #if EEPROM_USE_REGISTRY
+          else
+          {
+            EEPROMRegistry.cache(this->_registryIndex, true);
+          }
+          #endif
+        }
+      }
+
+      return returnValue;
+    }
+
+  protected:
+    /**
+     * @brief Gets the offset of a member within T.
+     * @details The offset is taken from a local T, since applying the
+     * member pointer to a null pointer is undefined. For the plain
+     * structures stored in EEPROM the compiler reduces it to a constant.
+     */
+    template <typename F, typename C>
+    static uint offsetOf(F C::*member)
+    {
+      T item;
+      return (uint)((const byte*)&(item.*member) - (const byte*)&item);
     }
 };
+
+/**
+ * @brief An EEPROMStorage<T> whose address and default value are known at
+ * compile time, so that an instance uses no RAM for them.
+ * @tparam T The type of the variable stored.
+ * @tparam Address The address of the variable within EEPROM.
+ * @tparam TDefault Provides the default value, see EEPROM-Placement.h.
+ * @tparam TChecksum The checksum policy.
+ */
+template <typename T, uint Address, typename TDefault = EEPROMDefault<T>, typename TChecksum = Checksum<T>>
+using EEPROMStaticStorage = EEPROMStorage<T, TChecksum, EEPROMStaticPlacement<T, Address, TDefault>>;
 #endif
\ No newline at end of file
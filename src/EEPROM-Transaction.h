@@ -0,0 +1,393 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_TRANSACTION_H
+#define EEPROM_TRANSACTION_H
+
+/**
+ * @file EEPROM-Transaction.h
+ * @brief This file contains the EEPROMTransaction definition.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+  #include <EEPROM.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+#include "EEPROM-Cache.h"
+#include "EEPROM-CRC.h"
+
+/**
+ * @class EEPROMTransaction
+ * @brief Commits several EEPROMCache<T> variables as one atomic change.
+ * @details The changed bytes of every added variable are first written to
+ * a redo journal in a separate region of EEPROM. A commit record is then
+ * written and only after that are the bytes copied to the variables. If
+ * the device is reset before the commit record is written the variables
+ * still hold their old values and the journal is discarded. If it is
+ * reset after, recover() replays the journal so that every variable has
+ * its new value.
+ *
+ * The journal region holds a one byte state, a CRC-8, a two byte length
+ * and a list of entries of [address (2 bytes)][count (1 byte)][bytes].
+ * Only the bytes in the dirty blocks of each variable that differ from
+ * EEPROM are journaled.
+ *
+ * Call recover() once at startup, after adding the variables and
+ * before using them.
+ */
+class EEPROMTransaction
+{
+  public:
+    static const uint HEADER_LENGTH = 4; ///< The number of bytes in the journal header.
+
+    /**
+     * @brief Initialize an instance of EEPROMTransaction with the journal region.
+     * @param address The address of the first byte of the journal within EEPROM.
+     * @param length The number of bytes in the journal region, including the header.
+     */
+    EEPROMTransaction(uint address, uint length) : _address(address), _length(length), _count(0)
+    {
+    }
+
+    /**
+     * @brief Adds a variable to the transaction.
+     * @param variable The variable to commit with the others.
+     * @return False if EEPROM_TRANSACTION_VARIABLES variables were already added, true otherwise.
+     */
+    template <typename T, typename TChecksum, typename TPlacement>
+    bool add(EEPROMCache<T, TChecksum, TPlacement>& variable)
+    {
+      bool returnValue = false;
+
+      if (this->_count < EEPROM_TRANSACTION_VARIABLES)
+      {
+        Variable& item = this->_variables[this->_count++];
+        item.instance = &variable;
+        item.journal = &EEPROMTransaction::journalVariable<T, TChecksum, TPlacement>;
+        item.markClean = &EEPROMTransaction::markVariableClean<T, TChecksum, TPlacement>;
+        item.restore = &EEPROMTransaction::restoreVariable<T, TChecksum, TPlacement>;
+        returnValue = true;
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Writes the changes of every added variable to EEPROM.
+     * @details The changes are journaled, the commit record is written,
+     * the changes are copied to the variables and the journal is cleared.
+     * When no variable has changed the EEPROM is not written.
+     * @return False if the changes do not fit in the journal, in which case
+     * nothing is committed and the variables remain dirty. True otherwise.
+     */
+    bool commit()
+    {
+      bool returnValue = true;
+
+      //
+      // Make sure the journal is not marked as committed while
+      // the entries are being written.
+      //
+      this->writeJournal(0, JOURNAL_EMPTY);
+
+      uint offset = HEADER_LENGTH;
+
+      for (uint i = 0; i < this->_count && returnValue; i++)
+      {
+        returnValue = this->_variables[i].journal(*this, this->_variables[i].instance, offset);
+      }
+
+      if (returnValue)
+      {
+        if (offset > HEADER_LENGTH)
+        {
+          //
+          // Write the length and checksum and then the commit record.
+          //
+          uint length = offset - HEADER_LENGTH;
+          this->writeJournal(2, (byte)length);
+          this->writeJournal(3, (byte)(length >> 8));
+          this->writeJournal(1, CRC8<byte>::getEEPROM(this->_address + 2, length + 2));
+          this->writeJournal(0, JOURNAL_COMMITTED);
+
+          this->replay();
+          this->writeJournal(0, JOURNAL_EMPTY);
+        }
+
+        for (uint i = 0; i < this->_count; i++)
+        {
+          this->_variables[i].markClean(this->_variables[i].instance);
+        }
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Completes or discards a transaction interrupted by a reset.
+     * @details Replays the journal if its commit record was written and
+     * its checksum is valid, then clears the journal and restores every
+     * added variable from EEPROM.
+     * @return True if the journal was replayed, false otherwise.
+     */
+    bool recover()
+    {
+      bool returnValue = false;
+      byte state = EEPROMUtil.readEEPROM(this->_address);
+
+      if (state == JOURNAL_COMMITTED && this->isValid())
+      {
+        this->replay();
+        returnValue = true;
+      }
+
+      if (state != JOURNAL_EMPTY)
+      {
+        this->writeJournal(0, JOURNAL_EMPTY);
+      }
+
+      for (uint i = 0; i < this->_count; i++)
+      {
+        this->_variables[i].restore(this->_variables[i].instance);
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Gets the address of the journal.
+     */
+    uint getAddress() const
+    {
+      return this->_address;
+    }
+
+    /**
+     * @brief Gets the number of bytes in the journal region.
+     */
+    uint length() const
+    {
+      return this->_length;
+    }
+
+    /**
+     * @brief Determines the next available EEPROM address after the journal.
+     */
+    uint nextAddress() const
+    {
+      return this->_address + this->_length;
+    }
+
+  protected:
+    static const byte JOURNAL_EMPTY = UNSET_VALUE;  ///< No transaction is in progress.
+    static const byte JOURNAL_COMMITTED = 0x5A;     ///< The journal is complete and has to be replayed.
+    static const uint MAX_RUN = 255;                ///< The maximum number of bytes in one entry.
+
+    /**
+     * @brief The type erased operations of one added variable.
+     */
+    struct Variable
+    {
+      void* instance;
+      bool (*journal)(EEPROMTransaction&, void*, uint&);
+      void (*markClean)(void*);
+      void (*restore)(void*);
+    };
+
+    uint _address;
+    uint _length;
+    uint _count;
+    Variable _variables[EEPROM_TRANSACTION_VARIABLES];
+
+    /**
+     * @brief Writes a byte to the journal if it differs from the stored byte.
+     */
+    void writeJournal(uint offset, byte value)
+    {
+      if (EEPROMUtil.readEEPROM(this->_address + offset) != value)
+      {
+        EEPROMUtil.writeEEPROM(this->_address + offset, value);
+      }
+    }
+
+    /**
+     * @brief Reads the length of the journal entries from the header.
+     */
+    uint entriesLength() const
+    {
+      return EEPROMUtil.readEEPROM(this->_address + 2) | (EEPROMUtil.readEEPROM(this->_address + 3) << 8);
+    }
+
+    /**
+     * @brief Checks that the journal entries fit in the region and match the checksum.
+     */
+    bool isValid() const
+    {
+      uint length = this->entriesLength();
+      return (length <= this->_length - HEADER_LENGTH) &&
+             (CRC8<byte>::getEEPROM(this->_address + 2, length + 2) == EEPROMUtil.readEEPROM(this->_address + 1));
+    }
+
+    /**
+     * @brief Copies every journal entry to its target address.
+     * @details The cached results in EEPROMRegistry (when EEPROM_USE_REGISTRY
+     * is true) are discarded since any registered variable may be changed.
+     */
+    void replay()
+    {
+      uint length = this->entriesLength();
+      uint offset = HEADER_LENGTH;
+
+      #if EEPROM_USE_REGISTRY
+      EEPROMRegistry.invalidate();
+      #endif
+
+      while (offset + 3 <= HEADER_LENGTH + length)
+      {
+        uint target = EEPROMUtil.readEEPROM(this->_address + offset) | (EEPROMUtil.readEEPROM(this->_address + offset + 1) << 8);
+        uint count = EEPROMUtil.readEEPROM(this->_address + offset + 2);
+        offset += 3;
+
+        for (uint i = 0; i < count; i++)
+        {
+          byte value = EEPROMUtil.readEEPROM(this->_address + offset + i);
+
+          if (EEPROMUtil.readEEPROM(target + i) != value)
+          {
+            EEPROMUtil.writeEEPROM(target + i, value);
+          }
+        }
+
+        offset += count;
+      }
+    }
+
+    /**
+     * @brief Appends entries for a run of changed bytes to the journal.
+     * @return False if the entries do not fit, true otherwise.
+     */
+    bool appendRun(uint target, const byte* data, uint count, uint& offset)
+    {
+      bool returnValue = true;
+
+      while (count > 0 && returnValue)
+      {
+        uint run = min(count, MAX_RUN);
+
+        if (offset + 3 + run > this->_length)
+        {
+          returnValue = false;
+        }
+        else
+        {
+          this->writeJournal(offset, (byte)target);
+          this->writeJournal(offset + 1, (byte)(target >> 8));
+          this->writeJournal(offset + 2, (byte)run);
+
+          for (uint i = 0; i < run; i++)
+          {
+            this->writeJournal(offset + 3 + i, data[i]);
+          }
+
+          offset += 3 + run;
+          target += run;
+          data += run;
+          count -= run;
+        }
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Journals the bytes of one variable, and of its checksum, that differ from EEPROM.
+     */
+    template <typename T, typename TChecksum, typename TPlacement>
+    static bool journalVariable(EEPROMTransaction& transaction, void* instance, uint& offset)
+    {
+      bool returnValue = true;
+      EEPROMCache<T, TChecksum, TPlacement>& variable = *(EEPROMCache<T, TChecksum, TPlacement>*)instance;
+
+      if (variable.isDirty())
+      {
+        typedef typename TChecksum::checksum_t checksum_t;
+
+        //
+        // The image is the cached value followed by its checksum
+        // in the same order as they are stored in EEPROM.
+        //
+        byte image[sizeof(T) + sizeof(checksum_t)];
+        memcpy(image, &variable._value, sizeof(T));
+        checksum_t checksum = TChecksum::get(variable._value);
+
+        for (uint i = 0; i < sizeof(checksum_t); i++)
+        {
+          image[sizeof(T) + i] = (byte)(checksum >> (8 * i));
+        }
+
+        uint start = 0;
+        uint count = 0;
+
+        for (uint i = 0; i <= sizeof(image) && returnValue; i++)
+        {
+          bool changed = (i < sizeof(image)) &&
+                         (i >= sizeof(T) || variable.isDirtyByte(i)) &&
+                         (EEPROMUtil.readEEPROM(variable.getAddress() + i) != image[i]);
+
+          if (changed)
+          {
+            if (count == 0)
+            {
+              start = i;
+            }
+
+            count++;
+          }
+          else if (count > 0)
+          {
+            returnValue = transaction.appendRun(variable.getAddress() + start, image + start, count, offset);
+            count = 0;
+          }
+        }
+      }
+
+      return returnValue;
+    }
+
+    template <typename T, typename TChecksum, typename TPlacement>
+    static void markVariableClean(void* instance)
+    {
+      ((EEPROMCache<T, TChecksum, TPlacement>*)instance)->markClean();
+    }
+
+    template <typename T, typename TChecksum, typename TPlacement>
+    static void restoreVariable(void* instance)
+    {
+      ((EEPROMCache<T, TChecksum, TPlacement>*)instance)->restore();
+    }
+};
+#endif
@@ -33,17 +33,66 @@
   #include <EEPROM.h>
 #elif defined(PARTICLE)
   #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
 #endif
 
 #include "EEPROM-Vars.h"
+#include "EEPROM-Device.h"
 
 /**
  * @class EEPROMUtilClass
  * @brief Provides the ability to clear the EEPROM memory.
+ * @details Every read and write made by the library goes through this
+ * class. By default they go to the internal EEPROM. After a call to
+ * setDevice() they go to the given EEPROMDevice, and blocks of bytes
+ * are compared and written one page at a time.
  */
 class EEPROMUtilClass
 {
   public:
+    /**
+     * @brief Gets the instance used by the library, named EEPROMUtil.
+     */
+    static EEPROMUtilClass& instance()
+    {
+      static EEPROMUtilClass returnValue;
+      return returnValue;
+    }
+
+    /**
+     * @brief Routes the reads and writes of the library to an external EEPROM.
+     * @param device The device, or nullptr to use the internal EEPROM.
+     */
+    void setDevice(EEPROMDevice* device)
+    {
+      this->_device = device;
+    }
+
+    /**
+     * @brief Gets the device set by setDevice(), or nullptr for the internal EEPROM.
+     */
+    EEPROMDevice* getDevice() const
+    {
+      return this->_device;
+    }
+
+    /**
+     * @brief Gets the number of bytes in the EEPROM.
+     */
+    uint length() const
+    {
+      return this->_device ? this->_device->length() : EEPROM.length();
+    }
+
+    /**
+     * @brief Gets the number of bytes written in one write cycle, 1 for the internal EEPROM.
+     */
+    uint pageSize() const
+    {
+      return this->_device ? max(this->_device->pageSize(), 1U) : 1;
+    }
+
     /**
      * @brief Resets the contents of EEPROM to the value specified.
      * @details Writes the byte specified by the parameter value to every
@@ -54,9 +103,58 @@ class EEPROMUtilClass
      */
     void clearEEPROM(uint value = UNSET_VALUE)
     {
-      for (uint i = 0; i < EEPROM.length(); i++)
+      this->clearEEPROM(value, 0, this->length());
+    }
+
+    /**
+     * @brief Resets a range of EEPROM to the value specified.
+     * @details The range is read in blocks of EEPROM_CLEAR_BLOCK bytes and
+     * blocks that already hold the value are skipped. Only the bytes that
+     * differ are written, one page at a time on an EEPROMDevice. On Particle
+     * devices clearing the whole EEPROM to UNSET_VALUE erases the emulated
+     * EEPROM with EEPROM.clear().
+     * @param value The value to write to the EEPROM.
+     * @param start The address of the first byte to clear.
+     * @param end The address after the last byte to clear.
+     */
+    void clearEEPROM(uint value, uint start, uint end)
+    {
+      end = min(end, this->length());
+
+      if (start >= end)
+      {
+        return;
+      }
+
+      #if defined(PARTICLE)
+      if (!this->_device && value == UNSET_VALUE && start == 0 && end == this->length())
       {
-        this->updateEEPROM(i, value);
+        EEPROM.clear();
+        return;
+      }
+      #endif
+
+      if (this->_device)
+      {
+        this->fillBlock(start, value, end - start);
+      }
+      else
+      {
+        byte buffer[EEPROM_CLEAR_BLOCK];
+
+        for (uint address = start; address < end; address += EEPROM_CLEAR_BLOCK)
+        {
+          uint count = min(end - address, (uint)EEPROM_CLEAR_BLOCK);
+          this->readBlock(address, buffer, count);
+
+          for (uint i = 0; i < count; i++)
+          {
+            if (buffer[i] != (byte)value)
+            {
+              EEPROM.write(address + i, value);
+            }
+          }
+        }
       }
     }
     
@@ -70,7 +168,11 @@ class EEPROMUtilClass
      */
     void updateEEPROM(uint address, byte value)
     {
-      if (address < EEPROM.length())
+      if (this->_device)
+      {
+        this->updateBlock(address, &value, 1);
+      }
+      else if (address < EEPROM.length())
       {
         #if defined(ESP8266)
         EEPROM.write(address, value);
@@ -79,10 +181,262 @@ class EEPROMUtilClass
         #endif
       }
     }
+
+    /**
+     * @brief Provides a unified method of unconditionally writing
+     * a byte to the EEPROM on multiple platforms.
+     * @details Callers are expected to have already compared the
+     * stored byte to the new value.
+     * @param address The address in EEPROM to write the value in.
+     * @param value The value to write to the EEPROM.
+     */
+    void writeEEPROM(uint address, byte value)
+    {
+      if (address < this->length())
+      {
+        if (this->_device)
+        {
+          this->_device->write(address, &value, 1);
+        }
+        else
+        {
+          EEPROM.write(address, value);
+        }
+      }
+    }
+
+    /**
+     * @brief Reads one byte from the EEPROM.
+     * @param address The address in EEPROM to read.
+     * @return The byte read.
+     */
+    byte readEEPROM(uint address) const
+    {
+      return this->_device ? this->_device->read(address) : EEPROM.read(address);
+    }
+
+    /**
+     * @brief Reads a block of bytes from the EEPROM.
+     * @param address The address in EEPROM of the first byte.
+     * @param data Receives the bytes read.
+     * @param length The number of bytes to read.
+     */
+    void readBlock(uint address, byte* data, uint length) const
+    {
+      if (this->_device)
+      {
+        this->_device->read(address, data, length);
+      }
+      else
+      {
+        #if defined(__AVR__)
+        eeprom_read_block(data, (const void*)address, length);
+        #else
+        for (uint i = 0; i < length; i++)
+        {
+          data[i] = EEPROM.read(address + i);
+        }
+        #endif
+      }
+    }
+
+    /**
+     * @brief Writes the bytes of a block that differ from the EEPROM.
+     * @details On the internal EEPROM each byte is compared and written
+     * on its own. On a device the stored bytes are read one page at a
+     * time and the changed bytes of each page are written in a single
+     * write cycle.
+     * @param address The address in EEPROM of the first byte.
+     * @param data The bytes to write.
+     * @param length The number of bytes to write.
+     * @param verify True to read back the changed bytes after they are written.
+     * @return False if the device reported a failed write or a byte was
+     * verified and did not match, true otherwise.
+     */
+    bool updateBlock(uint address, const byte* data, uint length, bool verify = false)
+    {
+      return this->update(address, data, length, false, verify);
+    }
+
+    /**
+     * @brief Sets every byte of a block that differs from the given value.
+     * @param address The address in EEPROM of the first byte.
+     * @param value The value to write.
+     * @param length The number of bytes to write.
+     * @param verify True to read back the changed bytes after they are written.
+     * @return False if the device reported a failed write or a byte was
+     * verified and did not match, true otherwise.
+     */
+    bool fillBlock(uint address, byte value, uint length, bool verify = false)
+    {
+      return this->update(address, &value, length, true, verify);
+    }
+
+    /**
+     * @brief Writes the bytes of a block that differ from the bytes already read from it.
+     * @details Used when the caller has read the stored bytes itself. On the internal
+     * EEPROM each changed byte is written on its own. On a device the span from the
+     * first to the last changed byte of each page is written in a single write cycle.
+     * @param address The address in EEPROM of the first byte.
+     * @param data The bytes to write.
+     * @param current The bytes currently stored at the address.
+     * @param length The number of bytes.
+     * @param verify True to read back the changed bytes after they are written.
+     * @return False if the device reported a failed write or a byte was
+     * verified and did not match, true otherwise.
+     */
+    bool writeChanges(uint address, const byte* data, const byte* current, uint length, bool verify)
+    {
+      bool returnValue = true;
+      length = (address < this->length()) ? min(length, this->length() - address) : 0;
+      uint pageSize = this->pageSize();
+
+      for (uint i = 0; i < length; )
+      {
+        uint count = min(length - i, pageSize - ((address + i) % pageSize));
+        uint first = count;
+        uint last = 0;
+
+        for (uint j = 0; j < count; j++)
+        {
+          if (current[i + j] != data[i + j])
+          {
+            first = min(first, j);
+            last = j;
+
+            if (!this->_device)
+            {
+              EEPROM.write(address + i + j, data[i + j]);
+              returnValue = !verify || (EEPROM.read(address + i + j) == data[i + j]) ? returnValue : false;
+            }
+          }
+        }
+
+        if (this->_device && first < count)
+        {
+          if (!this->_device->write(address + i + first, data + i + first, last - first + 1))
+          {
+            returnValue = false;
+          }
+
+          if (verify)
+          {
+            for (uint j = first; j <= last; j++)
+            {
+              if (this->_device->read(address + i + j) != data[i + j])
+              {
+                returnValue = false;
+              }
+            }
+          }
+        }
+
+        i += count;
+      }
+
+      return returnValue;
+    }
+
+  protected:
+    EEPROMDevice* _device = nullptr; ///< The external EEPROM, or nullptr for the internal EEPROM.
+
+    /**
+     * @brief Writes the changed bytes of a block. When fill is true the
+     * block is data[0] repeated length times.
+     */
+    bool update(uint address, const byte* data, uint length, bool fill, bool verify)
+    {
+      bool returnValue = true;
+      length = (address < this->length()) ? min(length, this->length() - address) : 0;
+
+      if (!this->_device)
+      {
+        for (uint i = 0; i < length; i++)
+        {
+          byte value = fill ? data[0] : data[i];
+
+          if (EEPROM.read(address + i) != value)
+          {
+            EEPROM.write(address + i, value);
+
+            if (verify && EEPROM.read(address + i) != value)
+            {
+              returnValue = false;
+            }
+          }
+        }
+      }
+      else
+      {
+        uint pageSize = max(this->_device->pageSize(), 1U);
+        byte buffer[EEPROM_DEVICE_BUFFER];
+
+        //
+        // Compare and write one page (or buffer) at a time.
+        //
+        for (uint i = 0; i < length; )
+        {
+          uint pageEnd = ((address + i) / pageSize + 1) * pageSize;
+          uint count = min(min(length - i, pageEnd - (address + i)), (uint)EEPROM_DEVICE_BUFFER);
+          const byte* source = fill ? buffer : data + i;
+
+          this->_device->read(address + i, buffer, count);
+
+          uint first = count;
+          uint last = 0;
+
+          for (uint j = 0; j < count; j++)
+          {
+            if (buffer[j] != (fill ? data[0] : source[j]))
+            {
+              first = min(first, j);
+              last = j;
+            }
+          }
+
+          if (first < count)
+          {
+            if (fill)
+            {
+              memset(buffer, data[0], count);
+            }
+
+            if (!this->_device->write(address + i + first, source + first, last - first + 1))
+            {
+              returnValue = false;
+            }
+
+            if (verify)
+            {
+              //
+              // Read back into a second buffer since the
+              // first one is the source of a fill.
+              //
+              byte stored[EEPROM_DEVICE_BUFFER];
+              this->_device->read(address + i + first, stored, last - first + 1);
+
+              for (uint j = first; j <= last; j++)
+              {
+                if (stored[j - first] != (fill ? data[0] : data[i + j]))
+                {
+                  returnValue = false;
+                }
+              }
+            }
+          }
+
+          i += count;
+        }
+      }
+
+      return returnValue;
+    }
 };
 
 /**
- * @brief Defines a static instance of EEPROMUtilClass.
+ * @brief The EEPROMUtilClass instance shared by every file of the program.
+ * @details EEPROMUtil names this instance, so a device set in one file
+ * is used by the variables declared in every other file.
  */
-static EEPROMUtilClass EEPROMUtil;
+#define EEPROMUtil (EEPROMUtilClass::instance())
 #endif
\ No newline at end of file
@@ -38,4 +38,120 @@
 
 #define UNSET_VALUE 0xFF ///< Defines the default value used when clearing the EEPROM memory.
 
+/**
+ * @brief Set to true to verify the bytes changed by EEPROMStorage<T>::set().
+ */
+#ifndef EEPROM_VERIFY_WRITES
+  #define EEPROM_VERIFY_WRITES false
+#endif
+
+/**
+ * @brief The number of bytes tracked by each dirty bit in EEPROMCache<T>. Larger
+ * blocks use less RAM for large types at the cost of writing whole blocks.
+ */
+#ifndef EEPROM_DIRTY_BLOCK_SIZE
+  #define EEPROM_DIRTY_BLOCK_SIZE 1
+#endif
+
+/**
+ * @brief Set to true to let Checksum<T> fold a machine word at a time instead of
+ * one byte at a time. The result is identical. Defaults to false on 8-bit AVR.
+ */
+#ifndef EEPROM_WIDE_CHECKSUM
+  #if defined(__AVR__)
+    #define EEPROM_WIDE_CHECKSUM false
+  #else
+    #define EEPROM_WIDE_CHECKSUM true
+  #endif
+#endif
+
+/**
+ * @brief The number of EEPROM bytes Checksum<T>::getEEPROM() reads into a stack
+ * buffer before folding them.
+ */
+#ifndef EEPROM_CHECKSUM_CHUNK
+  #define EEPROM_CHECKSUM_CHUNK 32
+#endif
+
+/**
+ * @brief The maximum number of variables that can be added to an EEPROMTransaction.
+ */
+#ifndef EEPROM_TRANSACTION_VARIABLES
+  #define EEPROM_TRANSACTION_VARIABLES 8
+#endif
+
+/**
+ * @brief The number of bytes of EEPROM that EEPROMLayout checks against at compile
+ * time. Uses E2END on AVR. Define it before including the library on other boards.
+ */
+#ifndef EEPROM_LAYOUT_CAPACITY
+  #if defined(E2END)
+    #define EEPROM_LAYOUT_CAPACITY (E2END + 1)
+  #elif defined(EEPROM_HOST_SIZE)
+    #define EEPROM_LAYOUT_CAPACITY EEPROM_HOST_SIZE
+  #else
+    #define EEPROM_LAYOUT_CAPACITY 4096
+  #endif
+#endif
+
+/**
+ * @brief The number of bytes EEPROMUtil compares at a time when writing to an
+ * EEPROMDevice. Writes are split at this size as well as at page boundaries, so
+ * it should be at least the page size of the device.
+ */
+#ifndef EEPROM_DEVICE_BUFFER
+  #define EEPROM_DEVICE_BUFFER 64
+#endif
+
+/**
+ * @brief The number of bytes EEPROMUtil.clearEEPROM() reads and compares at a time.
+ */
+#ifndef EEPROM_CLEAR_BLOCK
+  #define EEPROM_CLEAR_BLOCK 32
+#endif
+
+/**
+ * @brief Set to true to let variables use the results cached by EEPROMRegistry. When
+ * false (the default) EEPROMRegistry cannot be used and takes no RAM or flash. Define
+ * it the same way in every file of the sketch, before including the library.
+ */
+#ifndef EEPROM_USE_REGISTRY
+  #define EEPROM_USE_REGISTRY false
+#endif
+
+/**
+ * @brief The maximum number of variables that can be added to EEPROMRegistry.
+ */
+#ifndef EEPROM_REGISTRY_SIZE
+  #define EEPROM_REGISTRY_SIZE 32
+#endif
+
+/**
+ * @brief The number of bytes EEPROMRegistry.scan() reads at a time.
+ */
+#ifndef EEPROM_REGISTRY_BUFFER
+  #define EEPROM_REGISTRY_BUFFER 64
+#endif
+
+/**
+ * @brief The number of bytes EEPROMMirror tracks with one dirty bit.
+ */
+#ifndef EEPROM_MIRROR_PAGE
+  #define EEPROM_MIRROR_PAGE 32
+#endif
+
+/**
+ * @brief The default number of milliseconds EEPROMMirror keeps a write in RAM (0 for no limit).
+ */
+#ifndef EEPROM_MIRROR_DEADLINE
+  #define EEPROM_MIRROR_DEADLINE 1000
+#endif
+
+/**
+ * @brief The default number of bytes written to EEPROMMirror that cause a sync (0 for no limit).
+ */
+#ifndef EEPROM_MIRROR_BUDGET
+  #define EEPROM_MIRROR_BUDGET 256
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,601 @@
+// Copyright © 2017-2025 Daniel Porrey. All Rights Reserved.
+//
+// This file is part of the EEPROM-Storage library.
+//
+// EEPROM-Storage library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// EEPROM-Storage library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with EEPROM-Storage library. If not,
+// see http://www.gnu.org/licenses/.
+//
+#pragma once
+#ifndef EEPROM_WEAR_LEVELED_H
+#define EEPROM_WEAR_LEVELED_H
+
+/**
+ * @file EEPROM-WearLeveled.h
+ * @brief This file contains the EEPROMWearLeveled<T, Slots> definition.
+ */
+
+//
+// Cross-compatable with Arduino, GNU C++ for tests, and Particle.
+//
+#if defined(ARDUINO) && ARDUINO >= 100
+  #include <Arduino.h>
+  #include <EEPROM.h>
+#elif defined(PARTICLE)
+  #include <Particle.h>
+#else
+  #include "EEPROM-Host.h"
+#endif
+
+#include "EEPROM-Base.h"
+
+/**
+ * @class EEPROMWearLeveled
+ * @brief Provides direct access to an EEPROM variable whose writes
+ * are spread over a ring of slots.
+ * @details Each slot holds a one byte sequence number, the value and
+ * a checksum covering both. Every write goes to the slot after the
+ * newest one with the next sequence number, so each EEPROM cell is
+ * written once every Slots writes. The newest valid slot is located by
+ * scanning only the sequence bytes for the break in the sequence and
+ * is cached after the first access. If the newest slot fails its
+ * checksum (for example after a reset during a write) the previous
+ * slot is used. Apart from occupying Slots times the EEPROM memory
+ * this class can be used in place of EEPROMStorage<T>, except for the
+ * methods that expose the bytes of a single value and checksum
+ * (checksumByte(), checksum(), copyTo() and operator[]).
+ * @tparam T The type of the variable stored.
+ * @tparam Slots The number of copies in the ring (2 to 128).
+ * @tparam TChecksum The checksum policy, Checksum<T> (default) or one
+ * of the CRC policies in EEPROM-CRC.h.
+ */
+template <typename T, uint Slots, typename TChecksum = Checksum<T>>
+class EEPROMWearLeveled : public EEPROMBase<T, TChecksum, EEPROMWearLeveled<T, Slots, TChecksum>>
+{
+  static_assert(Slots >= 2 && Slots <= 128, "EEPROMWearLeveled requires between 2 and 128 slots.");
+
+  public:
+    typedef typename EEPROMBase<T, TChecksum, EEPROMWearLeveled<T, Slots, TChecksum>>::checksum_t checksum_t; ///< The type of the stored checksum.
+
+    static const uint LENGTH = Slots * (1 + sizeof(T) + sizeof(checksum_t)); ///< The number of EEPROM bytes used by all slots.
+
+    /**
+     * @brief Initialize an instance of EEPROMWearLeveled<T, Slots> with the specified address.
+     * @param address The address (or index) of the first slot within EEPROM.
+     */
+    EEPROMWearLeveled(const uint address) : EEPROMBase<T, TChecksum, EEPROMWearLeveled<T, Slots, TChecksum>>(address)
+    {
+    }
+
+    /**
+     * @brief Initialize an instance of EEPROMWearLeveled<T, Slots> with the specified address and default value.
+     * @param address The address (or index) of the first slot within EEPROM.
+     * @tparam defaultValue The default value returned when the variable has not been initialized.
+     */
+    EEPROMWearLeveled(const uint address, T defaultValue) : EEPROMBase<T, TChecksum, EEPROMWearLeveled<T, Slots, TChecksum>>(address, defaultValue)
+    {
+    }
+
+    /**
+     * @brief Initialize an instance of EEPROMWearLeveled<T, Slots> with an address checked by EEPROMLayout.
+     * @param address The checked address (or index) of the first slot within EEPROM.
+     */
+    EEPROMWearLeveled(EEPROMFixedAddress address) : EEPROMBase<T, TChecksum, EEPROMWearLeveled<T, Slots, TChecksum>>(address)
+    {
+    }
+
+    /**
+     * @brief Initialize an instance of EEPROMWearLeveled<T, Slots> with an address checked by EEPROMLayout and a default value.
+     * @param address The checked address (or index) of the first slot within EEPROM.
+     * @tparam defaultValue The default value returned when the variable has not been initialized.
+     */
+    EEPROMWearLeveled(EEPROMFixedAddress address, T defaultValue) : EEPROMBase<T, TChecksum, EEPROMWearLeveled<T, Slots, TChecksum>>(address, defaultValue)
+    {
+    }
+
+    /**
+     * @brief Allows assignment of a variable of type T value to be
+     * this instance's value.
+     * @details Accounts for EEPROMWearLeveled<T, Slots> = T.
+     * @tparam item The new value to store in EEPROM.
+     * @return A reference to the EEPROMWearLeveled<T, Slots> variable.
+     */
+    EEPROMWearLeveled<T, Slots, TChecksum>& operator = (T const& value)
+    {
+      this->set(value);
+      return *this;
+    }
+
+    /**
+     * @brief Allows assignment of one EEPROMWearLeveled<T, Slots> value to another.
+     * @details Accounts for EEPROMWearLeveled<T, Slots> = EEPROMWearLeveled<T, Slots>.
+     * @tparam item The new value to store in EEPROM.
+     * @return A reference to the EEPROMWearLeveled<T, Slots> variable.
+     */
+    EEPROMWearLeveled<T, Slots, TChecksum>& operator = (EEPROMWearLeveled<T, Slots, TChecksum> const& item)
+    {
+      this->set(item.get());
+      return *this;
+    }
+
+    /**
+     * @brief Get the variable value.
+     * @return The current value of the variable as type T.
+     */
+    T get() const
+    {
+      T returnValue;
+
+      if (!this->readSlot(this->activeSlot(), returnValue))
+      {
+        returnValue = this->getDefaultValue();
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Set the variable value.
+     * @details The value is written to the slot after the newest slot.
+     * @tparam value The new value to store in EEPROM.
+     * @return The stored value as type T.
+     */
+    T set(T const& value)
+    {
+      this->write(value);
+      return value;
+    }
+
+    /**
+     * @brief Read the value from the newest valid slot.
+     * @return The value read from EEPROM or the default value if no slot is valid.
+     */
+    T read() const
+    {
+      return this->get();
+    }
+
+    /**
+     * @brief Read the value from the newest valid slot.
+     * @param value Receives the value read from EEPROM or the default value if
+     * no slot is valid.
+     * @return True if a slot is valid, false otherwise.
+     */
+    bool read(T& value) const
+    {
+      bool returnValue = this->readSlot(this->activeSlot(), value);
+
+      if (!returnValue)
+      {
+        value = this->getDefaultValue();
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Write the value to the slot after the newest slot.
+     * @tparam value The new value to store in EEPROM.
+     * @param verify True to read back and compare the bytes that changed.
+     * @return True if the write succeeded (or was not verified), false otherwise.
+     */
+    bool write(T const& value, bool verify = false)
+    {
+      byte slot = 0;
+      byte sequence = 0;
+
+      if (this->activeSlot() != NO_SLOT)
+      {
+        slot = (this->_slot + 1) % Slots;
+        sequence = this->_sequence + 1;
+      }
+
+      bool returnValue = this->writeSlot(slot, sequence, value, verify);
+      this->_slot = slot;
+      this->_sequence = sequence;
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Checks whether the EEPROM variable has been initialized.
+     * @return True if at least one slot contains a valid value, false otherwise.
+     */
+    bool isInitialized() const
+    {
+      return this->activeSlot() != NO_SLOT;
+    }
+
+    /**
+     * @brief Returns the number of EEPROM bytes used by all slots.
+     * @return The number of bytes used in the EEPROM as an unsigned integer.
+     */
+    uint length() const
+    {
+      return Slots * this->slotLength();
+    }
+
+    /**
+     * @brief Gets the next EEPROM address after the last slot.
+     * @return The next address in EEPROM as an unsigned integer.
+     */
+    uint nextAddress() const
+    {
+      return this->normalizeAddress(this->getAddress() + this->length());
+    }
+
+    /**
+     * @brief Unset the variable.
+     * @details Change every slot back to UNSET_VALUE as if the variable has
+     * never been written to the EEPROM.
+     */
+    void unset(byte unsetValue = UNSET_VALUE)
+    {
+      for (uint i = 0; i < this->length(); i++)
+      {
+        EEPROMUtil.updateEEPROM(this->normalizeAddress(this->_address + i), unsetValue);
+      }
+
+      this->_scanned = false;
+    }
+
+    /**
+     * @brief Gets the index of the slot holding the current value.
+     * @return The slot index or NO_SLOT (0xFF) if no slot is valid.
+     */
+    byte activeSlot() const
+    {
+      if (!this->_scanned)
+      {
+        this->scan();
+      }
+
+      return this->_slot;
+    }
+
+    static const byte NO_SLOT = 0xFF; ///< Returned by activeSlot() when no slot is valid.
+
+  protected:
+    //
+    // These methods of EEPROMBase expect the value and its checksum at
+    // the address of the variable, which is not the layout of the slots.
+    //
+    using EEPROMBase<T, TChecksum, EEPROMWearLeveled<T, Slots, TChecksum>>::checksumAddress;
+    using EEPROMBase<T, TChecksum, EEPROMWearLeveled<T, Slots, TChecksum>>::checksumByte;
+    using EEPROMBase<T, TChecksum, EEPROMWearLeveled<T, Slots, TChecksum>>::checksum;
+    using EEPROMBase<T, TChecksum, EEPROMWearLeveled<T, Slots, TChecksum>>::copyTo;
+    using EEPROMBase<T, TChecksum, EEPROMWearLeveled<T, Slots, TChecksum>>::operator [];
+
+    mutable byte _slot = NO_SLOT;   ///< The cached index of the newest valid slot.
+    mutable byte _sequence = 0;     ///< The sequence number of the newest valid slot.
+    mutable bool _scanned = false;  ///< True once the slots have been scanned.
+
+    /**
+     * @brief The number of bytes in one slot (sequence, value and checksum).
+     */
+    uint slotLength() const
+    {
+      return 1 + sizeof(T) + sizeof(checksum_t);
+    }
+
+    /**
+     * @brief Gets the EEPROM address of the first byte (the sequence number) of a slot.
+     */
+    uint slotAddress(byte slot) const
+    {
+      return this->_address + (slot * this->slotLength());
+    }
+
+    /**
+     * @brief Locate the newest valid slot.
+     * @details The sequence numbers of consecutive slots increase by one so
+     * the newest slot is the one whose successor does not continue the
+     * sequence. Only the sequence bytes are read to find it; its checksum
+     * is then validated and, if invalid, the previous slots are tried.
+     */
+    void scan() const
+    {
+      byte first = EEPROMUtil.readEEPROM(this->slotAddress(0));
+      byte previous = first;
+      byte newest = Slots - 1;
+
+      for (byte slot = 1; slot < Slots; slot++)
+      {
+        byte sequence = EEPROMUtil.readEEPROM(this->slotAddress(slot));
+
+        if (sequence != (byte)(previous + 1))
+        {
+          newest = slot - 1;
+          break;
+        }
+
+        previous = sequence;
+      }
+
+      this->_slot = NO_SLOT;
+      this->_scanned = true;
+
+      //
+      // Walk backwards from the newest slot until a valid slot is found.
+      //
+      T value;
+
+      for (byte i = 0; i < Slots; i++)
+      {
+        byte slot = (newest + Slots - i) % Slots;
+
+        if (this->readSlot(slot, value))
+        {
+          this->_slot = slot;
+          this->_sequence = EEPROMUtil.readEEPROM(this->slotAddress(slot));
+          break;
+        }
+      }
+    }
+
+    /**
+     * @brief Read and validate the value stored in a slot.
+     * @param slot The index of the slot.
+     * @param value Receives the value stored in the slot.
+     * @return True if the slot checksum is valid, false otherwise.
+     */
+    bool readSlot(byte slot, T& value) const
+    {
+      bool returnValue = false;
+
+      if (slot != NO_SLOT)
+      {
+        //
+        // Read the sequence number and the value in one pass.
+        //
+        uint address = this->slotAddress(slot);
+        byte data[sizeof(T) + 1];
+        EEPROMUtil.readBlock(address, data, sizeof(data));
+
+        if (TChecksum::get(data, sizeof(data)) == this->readChecksum(address + sizeof(data)))
+        {
+          memcpy(&value, data + 1, sizeof(T));
+          returnValue = true;
+        }
+      }
+
+      return returnValue;
+    }
+
+    /**
+     * @brief Write a value with its sequence number and checksum to a slot.
+     * @return False if the slot was verified and did not match, true otherwise.
+     */
+    bool writeSlot(byte slot, byte sequence, T const& value, bool verify)
+    {
+      byte data[sizeof(T) + 1 + sizeof(checksum_t)];
+      data[0] = sequence;
+      memcpy(data + 1, &value, sizeof(T));
+      this->putChecksum(data + sizeof(T) + 1, TChecksum::get(data, sizeof(T) + 1));
+
+      return EEPROMUtil.updateBlock(this->slotAddress(slot), data, sizeof(data), verify);
+    }
+};
+
+/**
+ * @brief A variable stored in two copies that are written alternately (A/B slots).
+ * @details Each write goes to the stale copy with the next generation number, so
+ * a reset during a write leaves the previous value readable instead of falling
+ * back to the default value. The copy holding the current value is cached after
+ * the first access, so get() reads a single copy. The variable occupies
+ * 2 * (sizeof(T) + 2) bytes with the default checksum.
+ * @tparam T The type of the variable stored.
+ * @tparam TChecksum The checksum policy.
+ */
+template <typename T, typename TChecksum = Checksum<T>>
+using EEPROMPingPong = EEPROMWearLeveled<T, 2, TChecksum>;
+
+/**
+ * @class EEPROMWearLeveledCache
+ * @brief Provides cached access to an EEPROMWearLeveled variable.
+ * @details Works like EEPROMCache<T>: get() and set() use a copy of the
+ * value in RAM, restore() reads the newest valid slot and commit() writes
+ * the value to the next slot only when it changed since the last restore()
+ * or commit(). A reset during commit() leaves the previous value readable.
+ * @tparam T The type of the variable stored.
+ * @tparam Slots The number of copies in the ring (2 to 128).
+ * @tparam TChecksum The checksum policy.
+ */
+template <typename T, uint Slots, typename TChecksum = Checksum<T>>
+class EEPROMWearLeveledCache : public EEPROMOperators<T, EEPROMWearLeveledCache<T, Slots, TChecksum>>
+{
+  public:
+    static const uint LENGTH = EEPROMWearLeveled<T, Slots, TChecksum>::LENGTH; ///< The number of EEPROM bytes used by all slots.
+
+    /**
+     * @brief Initialize an instance of EEPROMWearLeveledCache<T, Slots> with the specified address.
+     * @param address The address (or index) of the first slot within EEPROM.
+     */
+    EEPROMWearLeveledCache(const uint address) : _storage(address)
+    {
+      //
+      // Read the current value from EEPROM.
+      //
+      this->restore();
+    }
+
+    /**
+     * @brief Initialize an instance of EEPROMWearLeveledCache<T, Slots> with the specified address and default value.
+     * @param address The address (or index) of the first slot within EEPROM.
+     * @tparam defaultValue The value cached when no slot is valid.
+     */
+    EEPROMWearLeveledCache(const uint address, T defaultValue) : _storage(address, defaultValue)
+    {
+      //
+      // Read the current value from EEPROM.
+      //
+      this->restore();
+    }
+
+    /**
+     * @brief Implicitly converts the class instance to the cached value.
+     * @return The cached value as type T.
+     */
+    operator T() const
+    {
+      return this->get();
+    }
+
+    /**
+     * @brief Allows assignment of a variable of type T value to be
+     * this instance's value.
+     * @tparam value The new value to cache.
+     * @return A reference to the EEPROMWearLeveledCache<T, Slots> variable.
+     */
+    EEPROMWearLeveledCache<T, Slots, TChecksum>& operator = (T const& value)
+    {
+      this->set(value);
+      return *this;
+    }
+
+    /**
+     * @brief Allows assignment of one EEPROMWearLeveledCache<T, Slots> value to another.
+     * @details Accounts for EEPROMWearLeveledCache<T, Slots> = EEPROMWearLeveledCache<T, Slots>.
+     * Only the value is copied and it is written by the next commit().
+     * @tparam item The variable whose value is cached.
+     * @return A reference to the EEPROMWearLeveledCache<T, Slots> variable.
+     */
+    EEPROMWearLeveledCache<T, Slots, TChecksum>& operator = (EEPROMWearLeveledCache<T, Slots, TChecksum> const& item)
+    {
+      this->set(item.get());
+      return *this;
+    }
+
+    /**
+     * @brief Get the variable value.
+     * @return The cached value of the variable as type T.
+     */
+    T get() const
+    {
+      return this->_value;
+    }
+
+    /**
+     * @brief Set the cached value.
+     * @tparam value The new value, written to EEPROM by the next commit().
+     * @return The cached value as type T.
+     */
+    T set(T const& value)
+    {
+      if (memcmp(&this->_value, &value, sizeof(T)) != 0)
+      {
+        this->_value = value;
+        this->_dirty = true;
+      }
+
+      return this->_value;
+    }
+
+    /**
+     * @brief Restores the cached value from the newest valid slot.
+     * @details If no slot is valid the default value is cached and
+     * written by the next commit().
+     * @return The value as type T.
+     */
+    T restore()
+    {
+      this->_dirty = !this->_storage.read(this->_value);
+      return this->_value;
+    }
+
+    /**
+     * @brief Writes the cached value to the next slot if it has changed.
+     * @return The value as type T.
+     */
+    T commit()
+    {
+      if (this->_dirty)
+      {
+        this->_storage.write(this->_value);
+        this->_dirty = false;
+      }
+
+      return this->_value;
+    }
+
+    /**
+     * @brief Checks whether the cached value has changed since the last restore() or commit().
+     * @return True if commit() has a value to write, false otherwise.
+     */
+    bool isDirty() const
+    {
+      return this->_dirty;
+    }
+
+    /**
+     * @brief Checks whether the EEPROM variable has been initialized.
+     * @return True if at least one slot contains a valid value, false otherwise.
+     */
+    bool isInitialized() const
+    {
+      return this->_storage.isInitialized();
+    }
+
+    /**
+     * @brief Unset the variable.
+     * @details Change every slot back to UNSET_VALUE. The cached value is kept
+     * and written by the next commit().
+     */
+    void unset(byte unsetValue = UNSET_VALUE)
+    {
+      this->_storage.unset(unsetValue);
+      this->_dirty = true;
+    }
+
+    /**
+     * @brief Returns the number of EEPROM bytes used by all slots.
+     * @return The number of bytes used in the EEPROM as an unsigned integer.
+     */
+    uint length() const
+    {
+      return this->_storage.length();
+    }
+
+    /**
+     * @brief Get the EEPROM address of the first slot.
+     * @return The memory address in EEPROM as an unsigned integer.
+     */
+    uint getAddress() const
+    {
+      return this->_storage.getAddress();
+    }
+
+    /**
+     * @brief Gets the next EEPROM address after the last slot.
+     * @return The next address in EEPROM as an unsigned integer.
+     */
+    uint nextAddress() const
+    {
+      return this->_storage.nextAddress();
+    }
+
+  protected:
+    EEPROMWearLeveled<T, Slots, TChecksum> _storage; ///< The slots in EEPROM.
+    T _value;                                       ///< The cached value of the variable.
+    bool _dirty = true;                             ///< True if the cached value has not been written.
+};
+
+/**
+ * @brief An EEPROMPingPong<T> whose value is cached like EEPROMCache<T>.
+ * @details set() changes the value in RAM and commit() writes it to the stale copy.
+ * @tparam T The type of the variable stored.
+ * @tparam TChecksum The checksum policy.
+ */
+template <typename T, typename TChecksum = Checksum<T>>
+using EEPROMPingPongCache = EEPROMWearLeveledCache<T, 2, TChecksum>;
+#endif